@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @namespace armpp::bench
+ * @brief Minimal host microbenchmark harness
+ *
+ * A benchmark is a function running the measured operation the requested number of times. The
+ * runner calibrates the iteration count, measures the wall time and counts the heap
+ * allocations made by the benchmark.
+ *
+ * ```c++
+ * ARMPP_BENCHMARK(to_chars, dec_u32)
+ * {
+ *     char buffer[16];
+ *     for (std::size_t i = 0; i < iterations; ++i) {
+ *         util::to_chars(buffer, sizeof(buffer), static_cast<std::uint32_t>(i));
+ *         bench::do_not_optimize(buffer);
+ *     }
+ * }
+ * ```
+ */
+namespace armpp::bench {
+
+using benchmark_function = void (*)(std::size_t iterations);
+
+/**
+ * @brief Register a benchmark, normally called by `ARMPP_BENCHMARK`
+ * @param name     Benchmark name, `group/name`
+ * @param function Benchmark function
+ */
+void
+register_benchmark(char const* name, benchmark_function function);
+
+struct registrar {
+    registrar(char const* name, benchmark_function function)
+    {
+        register_benchmark(name, function);
+    }
+};
+
+/**
+ * @brief Report a number measured by the benchmark besides the time, e.g. a compression ratio
+ *
+ * The value of the last run is printed under the benchmark row and written to the JSON report.
+ */
+void
+set_counter(char const* name, double value);
+
+/**
+ * @brief Make the compiler assume the value is used
+ */
+template <typename T>
+inline void
+do_not_optimize(T const& value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * @brief Make the compiler assume all memory is read and written
+ */
+inline void
+clobber_memory()
+{
+    asm volatile("" : : : "memory");
+}
+
+/**
+ * @brief Hide a value from the optimizer, so it's not constant folded
+ */
+template <typename T>
+inline T
+opaque(T value)
+{
+    if constexpr (std::is_scalar_v<T>) {
+        asm volatile("" : "+r"(value) : : "memory");
+    } else {
+        asm volatile("" : "+m"(value) : : "memory");
+    }
+    return value;
+}
+
+}    // namespace armpp::bench
+
+#define ARMPP_BENCHMARK(group, name)                                                               \
+    static void armpp_bench_##group##_##name(std::size_t iterations);                              \
+    static ::armpp::bench::registrar const armpp_bench_registrar_##group##_##name{                 \
+        #group "/" #name, &armpp_bench_##group##_##name};                                          \
+    static void armpp_bench_##group##_##name(std::size_t iterations)
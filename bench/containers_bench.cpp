@@ -0,0 +1,222 @@
+#include "bench.hpp"
+//
+#include <armpp/util/intrusive_list.hpp>
+#include <armpp/util/ring_buffer.hpp>
+#include <armpp/util/static_flat_map.hpp>
+#include <armpp/util/static_vector.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <map>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace util  = armpp::util;
+namespace bench = armpp::bench;
+
+// The std containers allocate on the host heap, the allocation counts in the report show where
+// the difference comes from.
+namespace {
+
+constexpr std::size_t batch_size = 16;
+constexpr std::size_t map_size   = 32;
+
+struct list_item : util::intrusive_list_node {
+    std::uint32_t value = 0;
+};
+
+// Sparse keys, like peripheral addresses or command hashes
+constexpr std::uint32_t
+map_key(std::size_t index)
+{
+    return static_cast<std::uint32_t>(index * 2654435761u) >> 8;
+}
+
+util::static_flat_map<std::uint32_t, std::uint32_t, map_size> const&
+flat_map()
+{
+    static auto const map = [] {
+        util::static_flat_map<std::uint32_t, std::uint32_t, map_size> map;
+        for (std::size_t i = 0; i < map_size; ++i) {
+            map.insert(map_key(i), static_cast<std::uint32_t>(i));
+        }
+        return map;
+    }();
+    return map;
+}
+
+// Lookups in a scrambled order, a repeating sequence would let the branch predictor learn the
+// tree walk
+constexpr std::size_t lookup_count = 256;
+
+constexpr auto lookup_keys = [] {
+    std::array<std::uint32_t, lookup_count> keys{};
+    std::uint32_t                           state = 1;
+    for (auto& key : keys) {
+        state = state * 1664525u + 1013904223u;
+        key   = map_key((state >> 16) % map_size);
+    }
+    return keys;
+}();
+
+template <typename Map>
+Map const&
+std_map()
+{
+    static auto const map = [] {
+        Map map;
+        for (std::size_t i = 0; i < map_size; ++i) {
+            map.emplace(map_key(i), static_cast<std::uint32_t>(i));
+        }
+        return map;
+    }();
+    return map;
+}
+
+}    // namespace
+
+//@{
+/** @name Vector */
+ARMPP_BENCHMARK(static_vector, push_batch)
+{
+    util::static_vector<std::uint32_t, batch_size> vector;
+    for (std::size_t i = 0; i < iterations; i += batch_size) {
+        for (std::size_t j = 0; j < batch_size; ++j) {
+            vector.push_back(bench::opaque(static_cast<std::uint32_t>(j)));
+        }
+        bench::do_not_optimize(vector);
+        vector.clear();
+    }
+}
+
+ARMPP_BENCHMARK(std_vector, push_batch)
+{
+    for (std::size_t i = 0; i < iterations; i += batch_size) {
+        std::vector<std::uint32_t> vector;
+        for (std::size_t j = 0; j < batch_size; ++j) {
+            vector.push_back(bench::opaque(static_cast<std::uint32_t>(j)));
+        }
+        bench::do_not_optimize(vector);
+    }
+}
+//@}
+
+//@{
+/** @name FIFO */
+ARMPP_BENCHMARK(ring_buffer, push_pop)
+{
+    util::ring_buffer<std::uint8_t, 64> buffer;
+    std::uint8_t                        byte = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        buffer.push(bench::opaque(static_cast<std::uint8_t>(i)));
+        buffer.pop(byte);
+        bench::do_not_optimize(byte);
+    }
+}
+
+ARMPP_BENCHMARK(ring_buffer, span_batch)
+{
+    util::ring_buffer<std::uint8_t, 64>  buffer;
+    std::array<std::uint8_t, batch_size> in{};
+    std::array<std::uint8_t, batch_size> out{};
+    // 48 bytes stay in the buffer, so the batches wrap around the storage end
+    buffer.commit(48);
+    for (std::size_t i = 0; i < iterations; i += batch_size) {
+        buffer.push(std::span<std::uint8_t const>{bench::opaque(in)});
+        buffer.pop(std::span<std::uint8_t>{out});
+        bench::do_not_optimize(out);
+    }
+}
+
+ARMPP_BENCHMARK(std_deque, push_pop)
+{
+    std::deque<std::uint8_t> buffer;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        buffer.push_back(bench::opaque(static_cast<std::uint8_t>(i)));
+        auto byte = buffer.front();
+        buffer.pop_front();
+        bench::do_not_optimize(byte);
+    }
+}
+
+ARMPP_BENCHMARK(std_deque, span_batch)
+{
+    std::deque<std::uint8_t>             buffer(48);
+    std::array<std::uint8_t, batch_size> in{};
+    std::array<std::uint8_t, batch_size> out{};
+    for (std::size_t i = 0; i < iterations; i += batch_size) {
+        auto const& src = bench::opaque(in);
+        buffer.insert(buffer.end(), src.begin(), src.end());
+        std::copy_n(buffer.begin(), batch_size, out.begin());
+        buffer.erase(buffer.begin(), buffer.begin() + batch_size);
+        bench::do_not_optimize(out);
+    }
+}
+//@}
+
+//@{
+/** @name List */
+ARMPP_BENCHMARK(intrusive_list, push_pop)
+{
+    std::array<list_item, batch_size> items;
+    util::intrusive_list<list_item>   list;
+    for (std::size_t i = 0; i < iterations; i += batch_size) {
+        for (auto& item : items) {
+            list.push_back(item);
+        }
+        bench::do_not_optimize(list.front());
+        while (!list.empty()) {
+            list.pop_front();
+        }
+    }
+}
+
+ARMPP_BENCHMARK(std_list, push_pop)
+{
+    std::list<std::uint32_t> list;
+    for (std::size_t i = 0; i < iterations; i += batch_size) {
+        for (std::size_t j = 0; j < batch_size; ++j) {
+            list.push_back(static_cast<std::uint32_t>(j));
+        }
+        bench::do_not_optimize(list.front());
+        while (!list.empty()) {
+            list.pop_front();
+        }
+    }
+}
+//@}
+
+//@{
+/** @name Lookup */
+ARMPP_BENCHMARK(static_flat_map, find)
+{
+    auto const& map = flat_map();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto value = map.find(bench::opaque(lookup_keys[i % lookup_count]));
+        bench::do_not_optimize(value);
+    }
+}
+
+ARMPP_BENCHMARK(std_map, find)
+{
+    auto const& map = std_map<std::map<std::uint32_t, std::uint32_t>>();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto value = map.find(bench::opaque(lookup_keys[i % lookup_count]));
+        bench::do_not_optimize(value);
+    }
+}
+
+ARMPP_BENCHMARK(std_unordered_map, find)
+{
+    auto const& map = std_map<std::unordered_map<std::uint32_t, std::uint32_t>>();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto value = map.find(bench::opaque(lookup_keys[i % lookup_count]));
+        bench::do_not_optimize(value);
+    }
+}
+//@}
@@ -0,0 +1,124 @@
+#include "bench.hpp"
+//
+#include <armpp/util/flags.hpp>
+
+#include <cstdint>
+
+namespace util  = armpp::util;
+namespace bench = armpp::bench;
+
+namespace {
+
+enum class event : std::uint32_t {
+    none     = 0,
+    rx       = 1 << 0,
+    tx       = 1 << 1,
+    rx_ovr   = 1 << 2,
+    tx_ovr   = 1 << 3,
+    timeout  = 1 << 8,
+    error    = 1 << 16,
+    shutdown = 1u << 31,
+};
+
+using events = util::flags<event>;
+
+}    // namespace
+
+ARMPP_BENCHMARK(flags, construct)
+{
+    for (std::size_t i = 0; i < iterations; ++i) {
+        events val{bench::opaque(event::rx), bench::opaque(event::tx), event::timeout};
+        bench::do_not_optimize(val);
+    }
+}
+
+ARMPP_BENCHMARK(flags, set_clear)
+{
+    events val;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        val |= bench::opaque(event::rx);
+        val &= ~events{bench::opaque(event::tx)};
+        bench::do_not_optimize(val);
+    }
+}
+
+ARMPP_BENCHMARK(flags, test)
+{
+    events      val{event::rx, event::error};
+    std::size_t hits = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        if (!!(bench::opaque(val) & event::error)) {
+            ++hits;
+        }
+    }
+    bench::do_not_optimize(hits);
+}
+
+ARMPP_BENCHMARK(flags, binary_ops)
+{
+    events lhs{event::rx, event::tx_ovr};
+    events rhs{event::tx, event::tx_ovr, event::shutdown};
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto val = (bench::opaque(lhs) | rhs) ^ (lhs & bench::opaque(rhs));
+        bench::do_not_optimize(val);
+    }
+}
+
+ARMPP_BENCHMARK(flags, shift)
+{
+    events val{event::rx};
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto shifted = (bench::opaque(val) << 8) >> 4;
+        bench::do_not_optimize(shifted);
+    }
+}
+
+ARMPP_BENCHMARK(flags, compare)
+{
+    events      lhs{event::rx, event::timeout};
+    events      rhs{event::rx};
+    std::size_t equal = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        if (bench::opaque(lhs) == bench::opaque(rhs)) {
+            ++equal;
+        }
+    }
+    bench::do_not_optimize(equal);
+}
+
+ARMPP_BENCHMARK(flags, scan_each_bit)
+{
+    events      val{event::rx, event::timeout, event::shutdown};
+    std::size_t sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto status = bench::opaque(val);
+        for (std::size_t bit = 0; bit < events::bits; ++bit) {
+            if (!!(status & static_cast<event>(1u << bit))) {
+                sum += bit;
+            }
+        }
+    }
+    bench::do_not_optimize(sum);
+}
+
+ARMPP_BENCHMARK(flags, for_each_set_bit)
+{
+    events      val{event::rx, event::timeout, event::shutdown};
+    std::size_t sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        util::for_each_set_bit(bench::opaque(val), [&](int bit) { sum += bit; });
+    }
+    bench::do_not_optimize(sum);
+}
+
+ARMPP_BENCHMARK(flags, set_flags)
+{
+    events        val{event::rx, event::timeout, event::shutdown};
+    std::uint32_t sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (auto flag : util::set_flags(bench::opaque(val))) {
+            sum ^= static_cast<std::uint32_t>(flag);
+        }
+    }
+    bench::do_not_optimize(sum);
+}
@@ -0,0 +1,88 @@
+#include "bench.hpp"
+//
+#include <armpp/chrono.hpp>
+#include <armpp/frequency.hpp>
+
+#include <chrono>
+
+namespace chrono    = armpp::chrono;
+namespace frequency = armpp::frequency;
+namespace bench     = armpp::bench;
+
+using namespace armpp::frequency::literals;
+using namespace armpp::chrono::literals;
+
+ARMPP_BENCHMARK(frequency, cast_down)
+{
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto val = frequency::frequency_cast<frequency::hertz>(bench::opaque(54_MHz));
+        bench::do_not_optimize(val);
+    }
+}
+
+ARMPP_BENCHMARK(frequency, cast_up)
+{
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto val = frequency::frequency_cast<frequency::megahertz>(bench::opaque(54'000'000_Hz));
+        bench::do_not_optimize(val);
+    }
+}
+
+ARMPP_BENCHMARK(frequency, compare_mixed)
+{
+    std::size_t less = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        if (bench::opaque(25_MHz) < bench::opaque(54'000_KHz)) {
+            ++less;
+        }
+    }
+    bench::do_not_optimize(less);
+}
+
+ARMPP_BENCHMARK(frequency, add_mixed)
+{
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto val = bench::opaque(1_MHz) + bench::opaque(500_KHz);
+        bench::do_not_optimize(val);
+    }
+}
+
+ARMPP_BENCHMARK(frequency, period_duration)
+{
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto val = bench::opaque(54_MHz).period_duration<chrono::picoseconds>();
+        bench::do_not_optimize(val);
+    }
+}
+
+ARMPP_BENCHMARK(frequency, from_duration)
+{
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto val = frequency::get_frequency(bench::opaque(250_us));
+        bench::do_not_optimize(val);
+    }
+}
+
+ARMPP_BENCHMARK(frequency, divide)
+{
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto val = bench::opaque(54_MHz) / bench::opaque(115'200_Hz);
+        bench::do_not_optimize(val);
+    }
+}
+
+ARMPP_BENCHMARK(chrono, duration_cast)
+{
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto val = std::chrono::duration_cast<chrono::milliseconds>(bench::opaque(123'456_us));
+        bench::do_not_optimize(val);
+    }
+}
+
+ARMPP_BENCHMARK(chrono, duration_add_mixed)
+{
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto val = bench::opaque(2_ms) + bench::opaque(750_us);
+        bench::do_not_optimize(val);
+    }
+}
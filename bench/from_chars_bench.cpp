@@ -0,0 +1,93 @@
+#include "bench.hpp"
+//
+#include <armpp/util/from_chars.hpp>
+#include <armpp/util/tokenizer.hpp>
+
+#include <cstdint>
+#include <string_view>
+
+namespace util  = armpp::util;
+namespace bench = armpp::bench;
+
+namespace {
+
+// Reference for the SWAR conversion, a multiply-add per digit
+bool
+parse_naive(std::string_view token, std::uint32_t& value)
+{
+    std::uint32_t acc = 0;
+    if (token.empty())
+        return false;
+    for (auto c : token) {
+        if (c < '0' || c > '9')
+            return false;
+        acc = acc * 10 + static_cast<std::uint32_t>(c - '0');
+    }
+    value = acc;
+    return true;
+}
+
+}    // namespace
+
+ARMPP_BENCHMARK(from_chars, dec_u32_naive)
+{
+    std::uint32_t value = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        parse_naive(bench::opaque(std::string_view{"4000000000"}), value);
+        bench::do_not_optimize(value);
+    }
+}
+
+ARMPP_BENCHMARK(from_chars, dec_u32)
+{
+    std::uint32_t value = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        util::from_chars(bench::opaque(std::string_view{"4000000000"}), value);
+        bench::do_not_optimize(value);
+    }
+}
+
+ARMPP_BENCHMARK(from_chars, dec_u32_short)
+{
+    std::uint32_t value = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        util::from_chars(bench::opaque(std::string_view{"115"}), value);
+        bench::do_not_optimize(value);
+    }
+}
+
+ARMPP_BENCHMARK(from_chars, dec_i32_negative)
+{
+    std::int32_t value = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        util::from_chars(bench::opaque(std::string_view{"-2000000000"}), value);
+        bench::do_not_optimize(value);
+    }
+}
+
+ARMPP_BENCHMARK(from_chars, hex_u32)
+{
+    std::uint32_t value = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        util::from_chars(bench::opaque(std::string_view{"deadbeef"}), value,
+                         util::number_base::hex);
+        bench::do_not_optimize(value);
+    }
+}
+
+ARMPP_BENCHMARK(from_chars, tokenize_command)
+{
+    std::uint32_t sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        util::tokenizer tokens{bench::opaque(std::string_view{"write 40004000 115200 8\r\n"})};
+        std::uint32_t   address = 0;
+        std::uint32_t   value   = 0;
+        std::uint32_t   count   = 0;
+        tokens.next();
+        tokens.next(address, util::number_base::hex);
+        tokens.next(value);
+        tokens.next(count);
+        sum += address + value + count;
+    }
+    bench::do_not_optimize(sum);
+}
@@ -0,0 +1,52 @@
+#include "bench.hpp"
+//
+#include <armpp/board/current.hpp>
+#include <armpp/log/log.hpp>
+
+#include <cstdint>
+
+namespace uart  = armpp::hal::uart;
+namespace log   = armpp::log;
+namespace bench = armpp::bench;
+
+namespace {
+
+constexpr log::rate unlimited{0, 1};
+
+// The clock doesn't tick in the benchmarks, a limited site passes its burst and then drops
+// everything, which is the fault storm case
+uart::uart_handle&
+sim_uart()
+{
+    static uart::uart_handle handle{armpp::board::current::uart0::base_address};
+    handle.set_output_number_base(uart::number_base::dec);
+    handle.set_output_width(0);
+    return handle;
+}
+
+}    // namespace
+
+ARMPP_BENCHMARK(log, rate_limited)
+{
+    auto& dev = sim_uart();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        ARMPP_LOG(warning, dev, "adc ", bench::opaque(static_cast<std::uint32_t>(i)), " mV");
+    }
+}
+
+ARMPP_BENCHMARK(log, unlimited)
+{
+    auto& dev = sim_uart();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        ARMPP_LOG_RATE(warning, unlimited, dev, "adc ",
+                       bench::opaque(static_cast<std::uint32_t>(i)), " mV");
+    }
+}
+
+ARMPP_BENCHMARK(log, uart_io)
+{
+    auto& dev = sim_uart();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        dev << "W: adc " << bench::opaque(static_cast<std::uint32_t>(i)) << " mV\r\n";
+    }
+}
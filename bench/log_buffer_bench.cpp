@@ -0,0 +1,68 @@
+#include "bench.hpp"
+//
+#include <armpp/board/current.hpp>
+#include <armpp/hal/uart_io.hpp>
+#include <armpp/hal/uart_log.hpp>
+#include <armpp/util/log_buffer.hpp>
+
+#include <cstddef>
+#include <string_view>
+
+namespace uart  = armpp::hal::uart;
+namespace util  = armpp::util;
+namespace bench = armpp::bench;
+
+namespace {
+
+constexpr std::size_t      buffer_capacity = 1024;
+constexpr std::string_view message{"sensor 3: 1234 mV\r\n"};
+
+uart::uart_handle&
+sim_uart()
+{
+    static uart::uart_handle handle{armpp::board::current::uart0::base_address};
+    return handle;
+}
+
+}    // namespace
+
+ARMPP_BENCHMARK(log_buffer, write_read)
+{
+    static util::log_buffer<buffer_capacity> buffer;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        buffer.write(bench::opaque(message));
+        auto data = buffer.read_span();
+        bench::do_not_optimize(data);
+        buffer.consume(data.size());
+    }
+}
+
+ARMPP_BENCHMARK(log_buffer, reserve_commit)
+{
+    static util::log_buffer<buffer_capacity> buffer;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        if (auto record = buffer.reserve(32)) {
+            record.commit(record.write(0, bench::opaque(message)));
+        }
+        auto data = buffer.read_span();
+        bench::do_not_optimize(data);
+        buffer.consume(data.size());
+    }
+}
+
+// The simulated UART never reports a full TX buffer, every write is drained at once
+ARMPP_BENCHMARK(log_buffer, uart_log_write)
+{
+    static uart::uart_log<buffer_capacity> log{sim_uart()};
+    for (std::size_t i = 0; i < iterations; ++i) {
+        log.write(bench::opaque(message));
+    }
+}
+
+ARMPP_BENCHMARK(log_buffer, uart_direct_write)
+{
+    auto& dev = sim_uart();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        dev << bench::opaque(message);
+    }
+}
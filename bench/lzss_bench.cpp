@@ -0,0 +1,154 @@
+#include "bench.hpp"
+//
+#include <armpp/board/current.hpp>
+#include <armpp/hal/uart_compress.hpp>
+#include <armpp/hal/uart_log.hpp>
+#include <armpp/util/lzss.hpp>
+#include <armpp/util/to_chars.hpp>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace uart  = armpp::hal::uart;
+namespace util  = armpp::util;
+namespace bench = armpp::bench;
+
+namespace {
+
+// Telemetry and log lines the way the firmware prints them, with slowly changing readings
+std::string const&
+sample_log()
+{
+    static std::string const log = [] {
+        std::string   text;
+        std::uint32_t seed = 1;
+        auto          next = [&] {
+            seed = seed * 1664525u + 1013904223u;
+            return seed >> 16;
+        };
+        auto number = [&](std::uint32_t val) {
+            char buffer[16];
+            util::to_chars(buffer, sizeof(buffer), val);
+            text += buffer;
+        };
+        for (std::uint32_t i = 0; i < 2000; ++i) {
+            text += "I: adc ch";
+            number(i % 4);
+            text += ' ';
+            number(3300 - 64 + next() % 128);
+            text += " mV\r\n";
+            if (i % 10 == 0) {
+                text += "I: tick ";
+                number(i * 100);
+                text += " temp ";
+                number(230 + next() % 8);
+                text += " fan ";
+                number(1200 + next() % 50);
+                text += " rpm\r\n";
+            }
+            if (i % 97 == 0) {
+                text += "W: overcurrent on channel ";
+                number(next() % 4);
+                text += " (3 suppressed)\r\n";
+            }
+        }
+        return text;
+    }();
+    return log;
+}
+
+std::string const&
+compressed_log()
+{
+    static std::string const compressed = [] {
+        std::string          out;
+        util::lzss_encoder<> encoder;
+        encoder.write(sample_log(), [&](char c) { out += c; });
+        encoder.flush([&](char c) { out += c; });
+        return out;
+    }();
+    return compressed;
+}
+
+template <typename Encoder>
+void
+encode_log(Encoder& encoder, std::size_t iterations)
+{
+    auto const&   log  = sample_log();
+    auto          in   = encoder.bytes_in();
+    auto          out  = encoder.bytes_out();
+    std::uint32_t sink = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        encoder.put(log[i % log.size()], [&](char c) { sink += static_cast<unsigned char>(c); });
+    }
+    bench::do_not_optimize(sink);
+    bench::set_counter("ratio", static_cast<double>(encoder.bytes_in() - in)
+                                    / static_cast<double>(encoder.bytes_out() - out));
+}
+
+uart::uart_handle&
+sim_uart()
+{
+    static uart::uart_handle handle{armpp::board::current::uart0::base_address};
+    handle.set_output_number_base(uart::number_base::dec);
+    handle.set_output_width(0);
+    return handle;
+}
+
+}    // namespace
+
+// One operation is one input byte
+ARMPP_BENCHMARK(lzss, encode_byte)
+{
+    static util::lzss_encoder<> encoder;
+    encode_log(encoder, iterations);
+}
+
+ARMPP_BENCHMARK(lzss, encode_byte_window_1k)
+{
+    static util::lzss_encoder<10, 4> encoder;
+    encode_log(encoder, iterations);
+}
+
+// One operation is one decoded byte
+ARMPP_BENCHMARK(lzss, decode_byte)
+{
+    auto const&                 compressed = compressed_log();
+    static util::lzss_decoder<> decoder;
+    std::size_t                 decoded = 0;
+    std::uint32_t               sink    = 0;
+    auto                        out     = [&](char c) {
+        sink += static_cast<unsigned char>(c);
+        ++decoded;
+    };
+    for (std::size_t i = 0; decoded < iterations; ++i) {
+        decoder.put(compressed[i % compressed.size()], out);
+    }
+    bench::do_not_optimize(sink);
+}
+
+// One operation is a log line written and flushed, the flush per line is the worst case ratio
+ARMPP_BENCHMARK(lzss, compressed_uart_line)
+{
+    static uart::uart_log<512>   log{sim_uart()};
+    static uart::compressed_uart dev{log};
+    auto                         in  = dev.encoder().bytes_in();
+    auto                         out = dev.encoder().bytes_out();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        dev << "I: adc ch" << static_cast<std::uint32_t>(i % 4) << ' '
+            << bench::opaque(static_cast<std::uint32_t>(3300 - i % 64)) << " mV\r\n";
+        dev.flush();
+    }
+    bench::set_counter("ratio", static_cast<double>(dev.encoder().bytes_in() - in)
+                                    / static_cast<double>(dev.encoder().bytes_out() - out));
+}
+
+ARMPP_BENCHMARK(lzss, uart_io_line)
+{
+    auto& dev = sim_uart();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        dev << "I: adc ch" << static_cast<std::uint32_t>(i % 4) << ' '
+            << bench::opaque(static_cast<std::uint32_t>(3300 - i % 64)) << " mV\r\n";
+    }
+}
@@ -0,0 +1,295 @@
+#include "bench.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string_view>
+#include <vector>
+
+//----------------------------------------------------------------------------
+// Allocation counting
+namespace {
+
+std::atomic<std::uint64_t> allocation_count{0};
+std::atomic<std::uint64_t> allocated_bytes{0};
+
+void*
+counted_allocate(std::size_t size)
+{
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+    if (auto ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+}    // namespace
+
+void*
+operator new(std::size_t size)
+{
+    return counted_allocate(size);
+}
+
+void*
+operator new[](std::size_t size)
+{
+    return counted_allocate(size);
+}
+
+void
+operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void
+operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void
+operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void
+operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+//----------------------------------------------------------------------------
+// Registry and runner
+namespace armpp::bench {
+
+namespace {
+
+struct benchmark {
+    char const*        name;
+    benchmark_function function;
+};
+
+struct counter {
+    char const* name;
+    double      value;
+};
+
+struct result {
+    char const*          name;
+    std::uint64_t        iterations;
+    double               ns_per_op;
+    double               allocs_per_op;
+    double               bytes_per_op;
+    std::vector<counter> counters;
+};
+
+struct options {
+    std::string_view filter;
+    char const*      json_file   = nullptr;
+    double           min_time_ns = 100e6;
+    unsigned         repetitions = 3;
+};
+
+std::vector<benchmark>&
+registry()
+{
+    static std::vector<benchmark> benchmarks;
+    return benchmarks;
+}
+
+std::vector<counter>&
+current_counters()
+{
+    static std::vector<counter> counters;
+    return counters;
+}
+
+double
+run_timed(benchmark_function function, std::size_t iterations)
+{
+    using clock = std::chrono::steady_clock;
+    auto start  = clock::now();
+    function(iterations);
+    auto end = clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count();
+}
+
+result
+run(benchmark const& bm, options const& opts)
+{
+    // Warm up the caches and the lazily initialized state
+    bm.function(1);
+
+    std::size_t iterations = 1;
+    auto        elapsed    = run_timed(bm.function, iterations);
+    while (elapsed < opts.min_time_ns) {
+        auto factor = elapsed > 0 ? opts.min_time_ns * 1.2 / elapsed : 100.0;
+        factor      = std::clamp(factor, 2.0, 100.0);
+        iterations  = static_cast<std::size_t>(iterations * factor);
+        elapsed     = run_timed(bm.function, iterations);
+    }
+
+    auto best = elapsed;
+    for (unsigned i = 1; i < opts.repetitions; ++i) {
+        best = std::min(best, run_timed(bm.function, iterations));
+    }
+
+    current_counters().clear();
+    auto allocs_before = allocation_count.load(std::memory_order_relaxed);
+    auto bytes_before  = allocated_bytes.load(std::memory_order_relaxed);
+    bm.function(iterations);
+    auto allocs = allocation_count.load(std::memory_order_relaxed) - allocs_before;
+    auto bytes  = allocated_bytes.load(std::memory_order_relaxed) - bytes_before;
+
+    return {bm.name,
+            iterations,
+            best / iterations,
+            static_cast<double>(allocs) / iterations,
+            static_cast<double>(bytes) / iterations,
+            current_counters()};
+}
+
+void
+print_table(std::vector<result> const& results)
+{
+    std::printf("%-44s %14s %12s %12s %12s\n", "benchmark", "iterations", "ns/op", "allocs/op",
+                "bytes/op");
+    for (auto const& res : results) {
+        std::printf("%-44s %14llu %12.3f %12.3f %12.1f\n", res.name,
+                    static_cast<unsigned long long>(res.iterations), res.ns_per_op,
+                    res.allocs_per_op, res.bytes_per_op);
+        for (auto const& cnt : res.counters) {
+            std::printf("    %-40s %14.3f\n", cnt.name, cnt.value);
+        }
+    }
+}
+
+void
+write_json(std::FILE* out, std::vector<result> const& results)
+{
+    std::fprintf(out, "{\n  \"context\": {\n");
+    std::fprintf(out, "    \"compiler\": \"%s\",\n", __VERSION__);
+#if defined(NDEBUG)
+    std::fprintf(out, "    \"assertions\": false\n");
+#else
+    std::fprintf(out, "    \"assertions\": true\n");
+#endif
+    std::fprintf(out, "  },\n  \"benchmarks\": [");
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        auto const& res = results[i];
+        std::fprintf(out,
+                     "%s\n    {\"name\": \"%s\", \"iterations\": %llu, \"ns_per_op\": %.4f, "
+                     "\"allocs_per_op\": %.4f, \"bytes_per_op\": %.4f",
+                     i == 0 ? "" : ",", res.name, static_cast<unsigned long long>(res.iterations),
+                     res.ns_per_op, res.allocs_per_op, res.bytes_per_op);
+        if (!res.counters.empty()) {
+            std::fprintf(out, ", \"counters\": {");
+            for (std::size_t j = 0; j < res.counters.size(); ++j) {
+                std::fprintf(out, "%s\"%s\": %.4f", j == 0 ? "" : ", ", res.counters[j].name,
+                             res.counters[j].value);
+            }
+            std::fprintf(out, "}");
+        }
+        std::fprintf(out, "}");
+    }
+    std::fprintf(out, "\n  ]\n}\n");
+}
+
+void
+usage(char const* program)
+{
+    std::fprintf(stderr,
+                 "Usage: %s [--filter <substring>] [--json <file|->] [--min-time <ms>] "
+                 "[--repetitions <n>]\n",
+                 program);
+}
+
+}    // namespace
+
+void
+register_benchmark(char const* name, benchmark_function function)
+{
+    registry().push_back({name, function});
+}
+
+void
+set_counter(char const* name, double value)
+{
+    auto& counters = current_counters();
+    auto  it       = std::find_if(counters.begin(), counters.end(), [&](auto const& cnt) {
+        return std::strcmp(cnt.name, name) == 0;
+    });
+    if (it != counters.end()) {
+        it->value = value;
+    } else {
+        counters.push_back({name, value});
+    }
+}
+
+}    // namespace armpp::bench
+
+int
+main(int argc, char* argv[])
+{
+    using namespace armpp::bench;
+
+    options opts;
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg{argv[i]};
+        if (i + 1 >= argc) {
+            usage(argv[0]);
+            return 1;
+        }
+        if (arg == "--filter") {
+            opts.filter = argv[++i];
+        } else if (arg == "--json") {
+            opts.json_file = argv[++i];
+        } else if (arg == "--min-time") {
+            opts.min_time_ns = std::atof(argv[++i]) * 1e6;
+        } else if (arg == "--repetitions") {
+            opts.repetitions = std::max(1, std::atoi(argv[++i]));
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    auto benchmarks = registry();
+    std::sort(benchmarks.begin(), benchmarks.end(), [](auto const& lhs, auto const& rhs) {
+        return std::strcmp(lhs.name, rhs.name) < 0;
+    });
+
+    std::vector<result> results;
+    for (auto const& bm : benchmarks) {
+        if (!opts.filter.empty()
+            && std::string_view{bm.name}.find(opts.filter) == std::string_view::npos) {
+            continue;
+        }
+        results.push_back(run(bm, opts));
+    }
+
+    auto json_to_stdout = opts.json_file && std::string_view{opts.json_file} == "-";
+    if (!json_to_stdout) {
+        print_table(results);
+    }
+    if (json_to_stdout) {
+        write_json(stdout, results);
+    } else if (opts.json_file) {
+        auto out = std::fopen(opts.json_file, "w");
+        if (!out) {
+            std::perror(opts.json_file);
+            return 1;
+        }
+        write_json(out, results);
+        std::fclose(out);
+    }
+    return 0;
+}
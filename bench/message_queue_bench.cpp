@@ -0,0 +1,65 @@
+#include "bench.hpp"
+//
+#include <armpp/util/message_queue.hpp>
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+namespace util  = armpp::util;
+namespace bench = armpp::bench;
+
+namespace {
+
+constexpr std::size_t queue_capacity = 64;
+constexpr std::size_t batch_size     = 16;
+
+using message = std::uint32_t;
+
+}    // namespace
+
+ARMPP_BENCHMARK(spsc_queue, push_pop)
+{
+    static util::spsc_queue<message, queue_capacity> queue;
+    message                                          value = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        queue.push(bench::opaque(static_cast<message>(i)));
+        queue.pop(value);
+        bench::do_not_optimize(value);
+    }
+}
+
+ARMPP_BENCHMARK(spsc_queue, push_pop_batch)
+{
+    static util::spsc_queue<message, queue_capacity> queue;
+    std::array<message, batch_size>                  in{};
+    std::array<message, batch_size>                  out{};
+    for (std::size_t i = 0; i < iterations; i += batch_size) {
+        queue.push(std::span<message const>{in});
+        queue.pop(std::span<message>{out});
+        bench::do_not_optimize(out);
+    }
+}
+
+ARMPP_BENCHMARK(mpsc_queue, push_pop)
+{
+    static util::mpsc_queue<message, queue_capacity> queue;
+    message                                          value = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        queue.push(bench::opaque(static_cast<message>(i)));
+        queue.pop(value);
+        bench::do_not_optimize(value);
+    }
+}
+
+ARMPP_BENCHMARK(mpsc_queue, push_pop_batch)
+{
+    static util::mpsc_queue<message, queue_capacity> queue;
+    std::array<message, batch_size>                  in{};
+    std::array<message, batch_size>                  out{};
+    for (std::size_t i = 0; i < iterations; i += batch_size) {
+        queue.push(std::span<message const>{in});
+        queue.pop(std::span<message>{out});
+        bench::do_not_optimize(out);
+    }
+}
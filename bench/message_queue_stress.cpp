@@ -0,0 +1,207 @@
+/**
+ * Host stress test of the message queues
+ *
+ * Producer threads push numbered messages, single and in batches, while the consumer pops them.
+ * A message carries the producer index and its sequence number, the consumer checks that every
+ * producer's messages arrive complete, once and in order. The queues are small, so the producers
+ * hit a full queue, and race each other for the tail index, all the time.
+ *
+ *     armpp_queue_stress [--producers <n>] [--messages <per producer>]
+ */
+#include <armpp/util/message_queue.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <span>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace util = armpp::util;
+
+namespace {
+
+using message = std::uint32_t;
+
+constexpr std::size_t   queue_capacity = 64;
+constexpr std::size_t   max_batch      = 8;
+constexpr unsigned      sequence_bits  = 24;
+constexpr std::uint32_t sequence_mask  = (1u << sequence_bits) - 1;
+
+constexpr message
+make_message(std::uint32_t producer, std::uint32_t sequence)
+{
+    return producer << sequence_bits | sequence;
+}
+
+struct options {
+    std::uint32_t producers = 4;
+    std::uint32_t messages  = 200000;
+};
+
+/**
+ * Push a batch, `mpsc_queue` pushes all the messages or none, `spsc_queue` as many as fit
+ * @return Number of the messages pushed
+ */
+template <typename Queue>
+std::uint32_t
+push_batch(Queue& queue, std::span<message const> batch)
+{
+    auto result = queue.push(batch);
+    if constexpr (std::is_same_v<decltype(result), bool>) {
+        return result ? static_cast<std::uint32_t>(batch.size()) : 0;
+    } else {
+        return static_cast<std::uint32_t>(result);
+    }
+}
+
+/**
+ * Push the messages of a producer, every third push is a batch of up to `max_batch` messages
+ */
+template <typename Queue>
+void
+produce(Queue& queue, std::uint32_t producer, std::uint32_t count)
+{
+    std::array<message, max_batch> batch{};
+    for (std::uint32_t sequence = 0; sequence < count;) {
+        auto size = sequence % 3 == 0 ? std::min<std::uint32_t>(1 + sequence % max_batch,
+                                                                count - sequence)
+                                      : 1;
+        if (size == 1) {
+            if (queue.push(make_message(producer, sequence))) {
+                ++sequence;
+                continue;
+            }
+        } else {
+            for (std::uint32_t i = 0; i < size; ++i) {
+                batch[i] = make_message(producer, sequence + i);
+            }
+            if (auto pushed = push_batch(queue, {batch.data(), size})) {
+                sequence += pushed;
+                continue;
+            }
+        }
+        std::this_thread::yield();
+    }
+}
+
+/**
+ * Pop the messages until the producers are done and the queue is empty, check their order
+ * @param done Number of the producers that pushed all their messages
+ * @return Number of the errors found
+ */
+template <typename Queue>
+std::uint32_t
+consume(Queue& queue, std::uint32_t producers, std::uint32_t count,
+        std::atomic<std::uint32_t> const& done)
+{
+    std::vector<std::uint32_t>     expected(producers, 0);
+    std::uint32_t                  errors = 0;
+    std::array<message, max_batch> batch{};
+    auto error = [&](std::uint32_t producer, std::uint32_t sequence, std::uint32_t wanted) {
+        if (errors++ < 10) {
+            std::fprintf(stderr, "producer %u: message %u, expected %u\n", producer, sequence,
+                         wanted);
+        }
+    };
+    while (true) {
+        // Read before popping, an empty queue after all the producers are done stays empty
+        auto finished = done.load() == producers;
+        auto popped   = queue.pop(std::span<message>{batch});
+        if (popped == 0) {
+            if (finished)
+                break;
+            std::this_thread::yield();
+            continue;
+        }
+        for (std::size_t i = 0; i < popped; ++i) {
+            auto producer = batch[i] >> sequence_bits;
+            auto sequence = batch[i] & sequence_mask;
+            if (producer >= producers) {
+                error(producer, sequence, 0);
+                continue;
+            }
+            if (sequence != expected[producer])
+                error(producer, sequence, expected[producer]);
+            expected[producer] = sequence + 1;
+        }
+    }
+    for (std::uint32_t producer = 0; producer < producers; ++producer) {
+        if (expected[producer] != count)
+            error(producer, expected[producer], count);
+    }
+    return errors;
+}
+
+template <typename Queue>
+bool
+run(char const* name, std::uint32_t producers, std::uint32_t count)
+{
+    static Queue queue;
+
+    std::atomic<bool>          start{false};
+    std::atomic<std::uint32_t> done{0};
+    std::vector<std::thread>   threads;
+    for (std::uint32_t p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            while (!start.load()) {
+                std::this_thread::yield();
+            }
+            produce(queue, p, count);
+            ++done;
+        });
+    }
+    start       = true;
+    auto errors = consume(queue, producers, count, done);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::printf("%-12s producers %2u messages %8u: %s\n", name, producers, count,
+                errors == 0 ? "ok" : "FAILED");
+    return errors == 0;
+}
+
+void
+usage(char const* program)
+{
+    std::fprintf(stderr, "Usage: %s [--producers <n>] [--messages <per producer>]\n", program);
+}
+
+}    // namespace
+
+int
+main(int argc, char** argv)
+{
+    options opts;
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg{argv[i]};
+        if (i + 1 >= argc) {
+            usage(argv[0]);
+            return 1;
+        }
+        if (arg == "--producers") {
+            opts.producers = static_cast<std::uint32_t>(std::max(1, std::atoi(argv[++i])));
+        } else if (arg == "--messages") {
+            opts.messages = static_cast<std::uint32_t>(std::max(1, std::atoi(argv[++i])));
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (opts.producers > 0xff || opts.messages > sequence_mask) {
+        std::fprintf(stderr, "At most 255 producers and %u messages each\n", sequence_mask);
+        return 1;
+    }
+
+    auto ok = run<util::spsc_queue<message, queue_capacity>>("spsc_queue", 1, opts.messages);
+    ok      = run<util::mpsc_queue<message, queue_capacity>>("mpsc_queue", opts.producers,
+                                                            opts.messages)
+        && ok;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,89 @@
+#include "bench.hpp"
+//
+#include <armpp/hal/nvic.hpp>
+
+namespace hal   = armpp::hal;
+namespace bench = armpp::bench;
+
+namespace {
+
+constexpr std::uint32_t irq_count = 240;
+
+hal::irqn_t
+irq(std::size_t i)
+{
+    return hal::irqn_t{static_cast<std::int32_t>(bench::opaque(i) % irq_count)};
+}
+
+}    // namespace
+
+ARMPP_BENCHMARK(nvic, enable_irq)
+{
+    hal::nvic::nvic_handle nvic;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        nvic->enable_irq(irq(i));
+    }
+}
+
+ARMPP_BENCHMARK(nvic, disable_irq)
+{
+    hal::nvic::nvic_handle nvic;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        nvic->disable_irq(irq(i));
+    }
+}
+
+ARMPP_BENCHMARK(nvic, irq_enabled)
+{
+    hal::nvic::nvic_handle nvic;
+    std::size_t            enabled = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        enabled += nvic->irq_enabled(irq(i));
+    }
+    bench::do_not_optimize(enabled);
+}
+
+ARMPP_BENCHMARK(nvic, set_clear_pending)
+{
+    hal::nvic::nvic_handle nvic;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        nvic->set_pending(irq(i));
+        nvic->clear_pending(irq(i));
+    }
+}
+
+ARMPP_BENCHMARK(nvic, is_active)
+{
+    hal::nvic::nvic_handle nvic;
+    std::size_t            active = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        active += nvic->is_active(irq(i));
+    }
+    bench::do_not_optimize(active);
+}
+
+ARMPP_BENCHMARK(nvic, set_irq_priority)
+{
+    hal::nvic::nvic_handle nvic;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        nvic->set_irq_priority(irq(i), i & 0xff);
+    }
+}
+
+ARMPP_BENCHMARK(nvic, get_irq_priority)
+{
+    hal::nvic::nvic_handle nvic;
+    std::uint32_t          sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        sum += nvic->get_irq_priority(irq(i));
+    }
+    bench::do_not_optimize(sum);
+}
+
+ARMPP_BENCHMARK(nvic, set_system_handler_priority)
+{
+    hal::nvic::nvic_handle nvic;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        nvic->set_irq_priority(bench::opaque(hal::irqn::pensv), i & 0xff);
+    }
+}
@@ -0,0 +1,94 @@
+#include "bench.hpp"
+//
+#include <armpp/util/pool_allocator.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+
+namespace util  = armpp::util;
+namespace bench = armpp::bench;
+
+// The host libc malloc stands in for newlib's, both are general purpose heaps with free lists
+// per size range, the pool numbers are the ones that carry over to the target.
+namespace {
+
+constexpr std::size_t batch_size = 16;
+
+// A request size mix of small callbacks and buffers
+constexpr std::array<std::size_t, batch_size> sizes{12, 24, 8,  100, 16, 48, 32, 64,
+                                                    20, 8,  120, 40, 16, 24, 56, 12};
+
+using pool_type = util::pool_allocator<util::pool_sync::none, util::pool_class{16, 64},
+                                       util::pool_class{32, 32}, util::pool_class{64, 32},
+                                       util::pool_class{128, 16}>;
+using isr_pool_type
+    = util::pool_allocator<util::pool_sync::interrupt_mask, util::pool_class{16, 64},
+                           util::pool_class{32, 32}, util::pool_class{64, 32},
+                           util::pool_class{128, 16}>;
+
+constinit pool_type     pool;
+constinit isr_pool_type isr_pool;
+
+template <typename Allocate, typename Release>
+void
+mixed_batch(std::size_t iterations, Allocate&& allocate, Release&& release)
+{
+    std::array<void*, batch_size> blocks{};
+    for (std::size_t i = 0; i < iterations; i += batch_size) {
+        for (std::size_t j = 0; j < batch_size; ++j) {
+            blocks[j] = allocate(bench::opaque(sizes[j]));
+        }
+        bench::do_not_optimize(blocks);
+        // Release every other block first, so the free lists get out of allocation order
+        for (std::size_t j = 0; j < batch_size; j += 2) {
+            release(blocks[j]);
+        }
+        for (std::size_t j = 1; j < batch_size; j += 2) {
+            release(blocks[j]);
+        }
+    }
+}
+
+}    // namespace
+
+ARMPP_BENCHMARK(pool_allocator, alloc_free)
+{
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto ptr = pool.allocate(bench::opaque(std::size_t{24}));
+        bench::do_not_optimize(ptr);
+        pool.deallocate(ptr);
+    }
+}
+
+ARMPP_BENCHMARK(pool_allocator, alloc_free_isr_safe)
+{
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto ptr = isr_pool.allocate(bench::opaque(std::size_t{24}));
+        bench::do_not_optimize(ptr);
+        isr_pool.deallocate(ptr);
+    }
+}
+
+ARMPP_BENCHMARK(pool_allocator, mixed_batch)
+{
+    mixed_batch(
+        iterations, [](std::size_t size) { return pool.allocate(size); },
+        [](void* ptr) { pool.deallocate(ptr); });
+}
+
+ARMPP_BENCHMARK(malloc, alloc_free)
+{
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto ptr = std::malloc(bench::opaque(std::size_t{24}));
+        bench::do_not_optimize(ptr);
+        std::free(ptr);
+    }
+}
+
+ARMPP_BENCHMARK(malloc, mixed_batch)
+{
+    mixed_batch(
+        iterations, [](std::size_t size) { return std::malloc(size); },
+        [](void* ptr) { std::free(ptr); });
+}
@@ -0,0 +1,145 @@
+#include "bench.hpp"
+//
+#include <armpp/hal/registers.hpp>
+
+#include <cstdint>
+
+namespace hal   = armpp::hal;
+namespace bench = armpp::bench;
+
+namespace {
+
+enum class mode_t : hal::raw_register { off = 0, slow = 1, fast = 2, turbo = 3 };
+
+using hal::access_mode;
+using hal::register_mode;
+
+template <access_mode Access, register_mode Mode>
+union test_register {
+    hal::read_write_register_field<hal::raw_register, 4, 12, Access, Mode> value;
+    hal::read_write_register_field<mode_t, 16, 2, Access, Mode>            mode;
+    hal::bool_read_write_register_field<24, Access, Mode>                  enable;
+
+    hal::detail::field_storage_type_t<hal::raw_register, Mode> raw;
+};
+
+template <access_mode Access, register_mode Mode>
+test_register<Access, Mode>&
+make_register()
+{
+    alignas(hal::raw_register) static std::byte storage[sizeof(test_register<Access, Mode>)];
+    return *reinterpret_cast<test_register<Access, Mode>*>(storage);
+}
+
+template <access_mode Access, register_mode Mode>
+void
+bench_get(std::size_t iterations)
+{
+    auto&             reg = make_register<Access, Mode>();
+    hal::raw_register sum = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        bench::clobber_memory();
+        sum += reg.value.get();
+    }
+    bench::do_not_optimize(sum);
+}
+
+template <access_mode Access, register_mode Mode>
+void
+bench_set(std::size_t iterations)
+{
+    auto& reg = make_register<Access, Mode>();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        reg.value = bench::opaque(static_cast<hal::raw_register>(i & 0xfff));
+        bench::clobber_memory();
+    }
+}
+
+template <access_mode Access, register_mode Mode>
+void
+bench_set_enum(std::size_t iterations)
+{
+    auto& reg = make_register<Access, Mode>();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        reg.mode = bench::opaque(mode_t::fast);
+        bench::clobber_memory();
+    }
+}
+
+template <access_mode Access, register_mode Mode>
+void
+bench_toggle_bool(std::size_t iterations)
+{
+    auto& reg = make_register<Access, Mode>();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        reg.enable = !reg.enable;
+        bench::clobber_memory();
+    }
+}
+
+constexpr auto field        = access_mode::field;
+constexpr auto bitwise      = access_mode::bitwise_logic;
+constexpr auto volatile_reg = register_mode::volatile_reg;
+constexpr auto plain_reg    = register_mode::non_volatile_reg;
+
+}    // namespace
+
+ARMPP_BENCHMARK(register_field, get_field_volatile)
+{
+    bench_get<field, volatile_reg>(iterations);
+}
+
+ARMPP_BENCHMARK(register_field, get_bitwise_volatile)
+{
+    bench_get<bitwise, volatile_reg>(iterations);
+}
+
+ARMPP_BENCHMARK(register_field, get_field_non_volatile)
+{
+    bench_get<field, plain_reg>(iterations);
+}
+
+ARMPP_BENCHMARK(register_field, get_bitwise_non_volatile)
+{
+    bench_get<bitwise, plain_reg>(iterations);
+}
+
+ARMPP_BENCHMARK(register_field, set_field_volatile)
+{
+    bench_set<field, volatile_reg>(iterations);
+}
+
+ARMPP_BENCHMARK(register_field, set_bitwise_volatile)
+{
+    bench_set<bitwise, volatile_reg>(iterations);
+}
+
+ARMPP_BENCHMARK(register_field, set_field_non_volatile)
+{
+    bench_set<field, plain_reg>(iterations);
+}
+
+ARMPP_BENCHMARK(register_field, set_bitwise_non_volatile)
+{
+    bench_set<bitwise, plain_reg>(iterations);
+}
+
+ARMPP_BENCHMARK(register_field, set_enum_field_volatile)
+{
+    bench_set_enum<field, volatile_reg>(iterations);
+}
+
+ARMPP_BENCHMARK(register_field, set_enum_bitwise_volatile)
+{
+    bench_set_enum<bitwise, volatile_reg>(iterations);
+}
+
+ARMPP_BENCHMARK(register_field, toggle_bool_field_volatile)
+{
+    bench_toggle_bool<field, volatile_reg>(iterations);
+}
+
+ARMPP_BENCHMARK(register_field, toggle_bool_bitwise_volatile)
+{
+    bench_toggle_bool<bitwise, volatile_reg>(iterations);
+}
@@ -0,0 +1,126 @@
+#include "bench.hpp"
+//
+#include <armpp/shell/shell.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace shell = armpp::shell;
+namespace util  = armpp::util;
+namespace bench = armpp::bench;
+
+namespace {
+
+std::uint32_t sink = 0;
+
+void
+peek(shell::response&, std::uint32_t address)
+{
+    sink += address;
+}
+
+void
+poke(shell::response&, std::uint32_t address, std::uint32_t value)
+{
+    sink += address ^ value;
+}
+
+bool
+baud(shell::response&, std::uint32_t rate)
+{
+    sink += rate;
+    return rate != 0;
+}
+
+void
+led(shell::response&, bool on)
+{
+    sink += on;
+}
+
+void
+no_args(shell::response&)
+{
+    ++sink;
+}
+
+using service_shell
+    = shell::shell<shell::command<"peek", peek>, shell::command<"poke", poke>,
+                   shell::command<"baud", baud>, shell::command<"led", led>,
+                   shell::command<"reset", no_args>, shell::command<"status", no_args>,
+                   shell::command<"version", no_args>, shell::command<"uptime", no_args>>;
+
+// The dispatch the shell replaces, a strcmp chain over a RAM table and hand parsed arguments
+struct chain_entry {
+    char const* name;
+    void (*handler)(util::tokenizer&);
+};
+
+chain_entry chain_table[] = {
+    {"peek", [](util::tokenizer&) { ++sink; }},    {"poke", [](util::tokenizer&) { ++sink; }},
+    {"baud", [](util::tokenizer& args) {
+         std::uint32_t rate = 0;
+         args.next(rate);
+         sink += rate;
+     }},
+    {"led", [](util::tokenizer&) { ++sink; }},     {"reset", [](util::tokenizer&) { ++sink; }},
+    {"status", [](util::tokenizer&) { ++sink; }},  {"version", [](util::tokenizer&) { ++sink; }},
+    {"uptime", [](util::tokenizer&) { ++sink; }},
+};
+
+void
+execute_chain(std::string_view line)
+{
+    char name[16]{};
+    util::tokenizer tokens{line};
+    auto            token = tokens.next();
+    std::copy_n(token.data(), std::min<std::size_t>(token.size(), sizeof(name) - 1), name);
+    for (auto& entry : chain_table) {
+        if (std::strcmp(entry.name, name) == 0) {
+            entry.handler(tokens);
+            return;
+        }
+    }
+}
+
+}    // namespace
+
+ARMPP_BENCHMARK(shell, strcmp_chain)
+{
+    for (std::size_t i = 0; i < iterations; ++i) {
+        execute_chain(bench::opaque(std::string_view{"uptime"}));
+    }
+    bench::do_not_optimize(sink);
+}
+
+ARMPP_BENCHMARK(shell, perfect_hash)
+{
+    char            buffer[64];
+    shell::response out{buffer};
+    for (std::size_t i = 0; i < iterations; ++i) {
+        service_shell::execute(bench::opaque(std::string_view{"uptime"}), out);
+    }
+    bench::do_not_optimize(sink);
+}
+
+ARMPP_BENCHMARK(shell, typed_arguments)
+{
+    char            buffer[64];
+    shell::response out{buffer};
+    for (std::size_t i = 0; i < iterations; ++i) {
+        service_shell::execute(bench::opaque(std::string_view{"poke 0x40004000 115200"}), out);
+    }
+    bench::do_not_optimize(sink);
+}
+
+ARMPP_BENCHMARK(shell, help)
+{
+    char            buffer[256];
+    shell::response out{buffer};
+    for (std::size_t i = 0; i < iterations; ++i) {
+        out.clear();
+        service_shell::execute(bench::opaque(std::string_view{"help"}), out);
+        bench::do_not_optimize(buffer);
+    }
+}
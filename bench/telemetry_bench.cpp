@@ -0,0 +1,132 @@
+#include "bench.hpp"
+//
+#include <armpp/board/current.hpp>
+#include <armpp/hal/uart_io.hpp>
+#include <armpp/telemetry/telemetry.hpp>
+#include <armpp/util/to_chars.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace uart      = armpp::hal::uart;
+namespace util      = armpp::util;
+namespace telemetry = armpp::telemetry;
+namespace bench     = armpp::bench;
+
+namespace {
+
+enum class motor_state : std::uint8_t { idle, run, fault };
+
+struct motor_sample {
+    std::uint32_t tick;
+    std::int16_t  current;
+    std::uint16_t speed;
+    std::uint16_t voltage;
+    motor_state   state;
+};
+
+using motor_schema
+    = telemetry::schema<"motor", 1,
+                        telemetry::field<"tick", &motor_sample::tick, telemetry::encoding::delta>,
+                        telemetry::field<"current", &motor_sample::current,
+                                         telemetry::encoding::delta>,
+                        telemetry::field<"speed", &motor_sample::speed, telemetry::encoding::delta>,
+                        telemetry::field<"voltage", &motor_sample::voltage>,
+                        telemetry::field<"state", &motor_sample::state>>;
+
+// A control loop sample every 10 ms with slowly changing readings
+motor_sample
+make_sample(std::size_t i)
+{
+    auto step = static_cast<std::uint32_t>(i);
+    return {
+        .tick    = 100000 + step * 10,
+        .current = static_cast<std::int16_t>(-1200 + static_cast<int>(step % 32)),
+        .speed   = static_cast<std::uint16_t>(3000 + step % 16),
+        .voltage = static_cast<std::uint16_t>(24000 + step % 8),
+        .state   = motor_state::run,
+    };
+}
+
+// The text the operator<< chain prints for the same sample
+std::size_t
+format_text(motor_sample const& sample, char* out)
+{
+    auto start  = out;
+    auto append = [&](std::string_view str) {
+        std::memcpy(out, str.data(), str.size());
+        out += str.size();
+    };
+    auto number = [&](auto val) {
+        char buffer[24];
+        util::to_chars(buffer, sizeof(buffer), val);
+        append(buffer);
+    };
+    append("motor tick ");
+    number(sample.tick);
+    append(" current ");
+    number(sample.current);
+    append(" speed ");
+    number(sample.speed);
+    append(" voltage ");
+    number(sample.voltage);
+    append(" state ");
+    number(static_cast<unsigned>(sample.state));
+    append("\r\n");
+    return static_cast<std::size_t>(out - start);
+}
+
+uart::uart_handle&
+sim_uart()
+{
+    static uart::uart_handle handle{armpp::board::current::uart0::base_address};
+    handle.set_output_number_base(uart::number_base::dec);
+    handle.set_output_width(0);
+    return handle;
+}
+
+}    // namespace
+
+ARMPP_BENCHMARK(telemetry, encode_binary)
+{
+    static telemetry::encoder<motor_schema> encoder;
+    char                                    buffer[motor_schema::max_frame_size];
+    std::size_t                             bytes = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        bytes += encoder.encode(make_sample(bench::opaque(i)), buffer);
+        bench::do_not_optimize(buffer);
+    }
+    bench::set_counter("bytes/sample", static_cast<double>(bytes) / iterations);
+}
+
+ARMPP_BENCHMARK(telemetry, format_text)
+{
+    char        buffer[128];
+    std::size_t bytes = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        bytes += format_text(make_sample(bench::opaque(i)), buffer);
+        bench::do_not_optimize(buffer);
+    }
+    bench::set_counter("bytes/sample", static_cast<double>(bytes) / iterations);
+}
+
+ARMPP_BENCHMARK(telemetry, uart_binary)
+{
+    static telemetry::encoder<motor_schema> encoder;
+    auto&                                   dev = sim_uart();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        encoder.write(dev, make_sample(bench::opaque(i)));
+    }
+}
+
+ARMPP_BENCHMARK(telemetry, uart_text)
+{
+    auto& dev = sim_uart();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        auto sample = make_sample(bench::opaque(i));
+        dev << "motor tick " << sample.tick << " current " << sample.current << " speed "
+            << sample.speed << " voltage " << sample.voltage << " state " << sample.state
+            << "\r\n";
+    }
+}
@@ -0,0 +1,85 @@
+#include "bench.hpp"
+//
+#include <armpp/util/to_chars.hpp>
+
+#include <cstdint>
+
+namespace util = armpp::util;
+namespace bench = armpp::bench;
+
+ARMPP_BENCHMARK(to_chars, dec_u32)
+{
+    char buffer[16];
+    for (std::size_t i = 0; i < iterations; ++i) {
+        util::to_chars(buffer, sizeof(buffer), bench::opaque(static_cast<std::uint32_t>(i)));
+        bench::do_not_optimize(buffer);
+    }
+}
+
+ARMPP_BENCHMARK(to_chars, dec_u32_max)
+{
+    char buffer[16];
+    for (std::size_t i = 0; i < iterations; ++i) {
+        util::to_chars(buffer, sizeof(buffer), bench::opaque(std::uint32_t{0xffffffff}));
+        bench::do_not_optimize(buffer);
+    }
+}
+
+ARMPP_BENCHMARK(to_chars, dec_i32_negative)
+{
+    char buffer[16];
+    for (std::size_t i = 0; i < iterations; ++i) {
+        util::to_chars(buffer, sizeof(buffer), bench::opaque(-static_cast<std::int32_t>(i)));
+        bench::do_not_optimize(buffer);
+    }
+}
+
+ARMPP_BENCHMARK(to_chars, dec_u32_width)
+{
+    char buffer[16];
+    for (std::size_t i = 0; i < iterations; ++i) {
+        util::to_chars(buffer, sizeof(buffer), bench::opaque(static_cast<std::uint32_t>(i)),
+                       util::number_base::dec, 10);
+        bench::do_not_optimize(buffer);
+    }
+}
+
+ARMPP_BENCHMARK(to_chars, hex_u32)
+{
+    char buffer[16];
+    for (std::size_t i = 0; i < iterations; ++i) {
+        util::to_chars(buffer, sizeof(buffer), bench::opaque(static_cast<std::uint32_t>(i)),
+                       util::number_base::hex, 8, '0');
+        bench::do_not_optimize(buffer);
+    }
+}
+
+ARMPP_BENCHMARK(to_chars, oct_u32)
+{
+    char buffer[16];
+    for (std::size_t i = 0; i < iterations; ++i) {
+        util::to_chars(buffer, sizeof(buffer), bench::opaque(static_cast<std::uint32_t>(i)),
+                       util::number_base::oct);
+        bench::do_not_optimize(buffer);
+    }
+}
+
+ARMPP_BENCHMARK(to_chars, bin_u32)
+{
+    char buffer[48];
+    for (std::size_t i = 0; i < iterations; ++i) {
+        util::to_chars(buffer, sizeof(buffer), bench::opaque(static_cast<std::uint32_t>(i)),
+                       util::number_base::bin);
+        bench::do_not_optimize(buffer);
+    }
+}
+
+ARMPP_BENCHMARK(to_chars, pointer)
+{
+    char buffer[24];
+    int  value = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        util::to_chars(buffer, sizeof(buffer), bench::opaque(&value));
+        bench::do_not_optimize(buffer);
+    }
+}
@@ -0,0 +1,133 @@
+#include "bench.hpp"
+//
+#include <armpp/board/current.hpp>
+#include <armpp/hal/uart_io.hpp>
+
+#include <string_view>
+
+namespace hal   = armpp::hal;
+namespace uart  = armpp::hal::uart;
+namespace bench = armpp::bench;
+
+using namespace armpp::frequency::literals;
+using namespace armpp::chrono::literals;
+
+namespace {
+
+enum class status : std::uint8_t { idle = 0, busy = 1, error = 2 };
+enum class event : std::uint8_t { rx = 1, tx = 2, rx_ovr = 4, tx_ovr = 8 };
+
+// The simulated UART never reports a full TX buffer, the numbers are the cost of formatting and
+// of the data register writes
+uart::uart_handle&
+sim_uart()
+{
+    static uart::uart_handle handle{armpp::board::current::uart0::base_address};
+    handle.set_output_number_base(uart::number_base::dec);
+    handle.set_output_width(0);
+    return handle;
+}
+
+}    // namespace
+
+ARMPP_BENCHMARK(uart_io, put_char)
+{
+    auto& dev = sim_uart();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        dev << bench::opaque('x');
+    }
+}
+
+ARMPP_BENCHMARK(uart_io, c_string)
+{
+    auto& dev = sim_uart();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        dev << bench::opaque("Hello, world!\r\n");
+    }
+}
+
+ARMPP_BENCHMARK(uart_io, string_view)
+{
+    auto&                      dev = sim_uart();
+    constexpr std::string_view str{"Hello, world!\r\n"};
+    for (std::size_t i = 0; i < iterations; ++i) {
+        dev << bench::opaque(str);
+    }
+}
+
+ARMPP_BENCHMARK(uart_io, integer_dec)
+{
+    auto& dev = sim_uart();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        dev << bench::opaque(static_cast<std::uint32_t>(i));
+    }
+}
+
+ARMPP_BENCHMARK(uart_io, integer_hex_width)
+{
+    auto& dev = sim_uart();
+    dev << uart::hex_out << uart::width_out(8);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        dev << bench::opaque(static_cast<std::uint32_t>(i));
+    }
+}
+
+ARMPP_BENCHMARK(uart_io, integer_bin)
+{
+    auto& dev = sim_uart();
+    dev << uart::bin_out;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        dev << bench::opaque(static_cast<std::uint8_t>(i));
+    }
+}
+
+ARMPP_BENCHMARK(uart_io, enumeration)
+{
+    auto& dev = sim_uart();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        dev << bench::opaque(status::error);
+    }
+}
+
+ARMPP_BENCHMARK(uart_io, flags)
+{
+    auto&                      dev = sim_uart();
+    armpp::util::flags<event> val{event::rx, event::tx_ovr};
+    for (std::size_t i = 0; i < iterations; ++i) {
+        dev << bench::opaque(val);
+    }
+}
+
+ARMPP_BENCHMARK(uart_io, frequency)
+{
+    auto& dev = sim_uart();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        dev << bench::opaque(54_MHz);
+    }
+}
+
+ARMPP_BENCHMARK(uart_io, duration)
+{
+    auto& dev = sim_uart();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        dev << bench::opaque(1500_us);
+    }
+}
+
+ARMPP_BENCHMARK(uart_io, pointer)
+{
+    auto& dev   = sim_uart();
+    int   value = 0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        dev << bench::opaque(&value);
+    }
+}
+
+ARMPP_BENCHMARK(uart_io, mixed_line)
+{
+    auto& dev = sim_uart();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        dev << "tick " << bench::opaque(static_cast<std::uint32_t>(i)) << " at "
+            << bench::opaque(54_MHz) << " took " << bench::opaque(12_us) << "\r\n";
+    }
+}
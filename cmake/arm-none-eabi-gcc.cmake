@@ -2,6 +2,13 @@ set(HAVE_FLAG_SEARCH_PATHS_FIRST 0)
 
 set(TARGET_TRIPLET arm-none-eabi)
 
+# Board profile, sets the processor, memory layout and peripheral addresses.
+# Pass -DARMPP_BOARD=<name> to pick cmake/boards/<name>.cmake
+list(APPEND CMAKE_TRY_COMPILE_PLATFORM_VARIABLES ARMPP_BOARD)
+if (ARMPP_BOARD)
+    include(${CMAKE_CURRENT_LIST_DIR}/boards/${ARMPP_BOARD}.cmake)
+endif()
+
 find_program(
     ARM_C_COMPILER 
     NAMES ${TARGET_TRIPLET}-gcc
@@ -28,6 +35,27 @@ find_program(
     REQUIRED
 )
 
+find_program(
+    ARM_NM
+    NAMES ${TARGET_TRIPLET}-nm
+    HINTS /Applications/ARM/bin
+    REQUIRED
+)
+
+find_program(
+    ARM_OBJDUMP
+    NAMES ${TARGET_TRIPLET}-objdump
+    HINTS /Applications/ARM/bin
+    REQUIRED
+)
+
+find_program(
+    ARM_CXXFILT
+    NAMES ${TARGET_TRIPLET}-c++filt
+    HINTS /Applications/ARM/bin
+    REQUIRED
+)
+
 # TODO if mac os
 execute_process(COMMAND ${ARM_CXX_COMPILER} -print-sysroot OUTPUT_VARIABLE ARM_SYSROOT OUTPUT_STRIP_TRAILING_WHITESPACE)
 message(STATUS "Sys root ${ARM_SYSROOT}")
@@ -56,6 +84,14 @@ add_compile_options(
     )
 
 
+# Core profile for armpp::hal::core, the compiler macros don't tell M0+ from M0 and M7 from M4
+string(REPLACE "-" "_" ARMPP_CORE "${TARGET_PROCESSOR}")
+if (ARMPP_CORE MATCHES "^cortex_m(0|0plus|3|4|7)$")
+    add_compile_definitions(ARMPP_CORE=${ARMPP_CORE})
+else()
+    message(WARNING "No armpp core profile for ${TARGET_PROCESSOR}, using the architecture macros")
+endif()
+
 # Don't run the linker on compiler check
 set(CMAKE_TRY_COMPILE_TARGET_TYPE STATIC_LIBRARY)
 
@@ -76,4 +112,8 @@ add_compile_definitions(__STARTUP_CLEAR_BSS)
 
 enable_language(C CXX ASM)
 
-set(ARMPP_SYSTEM_FREQUENCY 54_MHz)
+if (ARMPP_BOARD_CLOCK_HZ)
+    set(ARMPP_SYSTEM_FREQUENCY ${ARMPP_BOARD_CLOCK_HZ}_Hz)
+else()
+    set(ARMPP_SYSTEM_FREQUENCY 54_MHz)
+endif()
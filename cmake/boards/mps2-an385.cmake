@@ -0,0 +1,32 @@
+# ARM MPS2 FPGA prototyping board with the AN385 Cortex-M3 image.
+# QEMU emulates the board as `-M mps2-an385`, the firmware built for it runs without hardware.
+#
+# Board profile variables:
+#   TARGET_PROCESSOR            -mcpu value
+#   ARMPP_BOARD_DESCRIPTOR      board descriptor, include/armpp/board/<name>.hpp, lists the
+#                               peripheral addresses and IRQ lines
+#   ARMPP_BOARD_CLOCK_HZ        core and peripheral clock in Hz
+#   ARMPP_BOARD_FLASH_ORIGIN    code memory start
+#   ARMPP_BOARD_FLASH_LENGTH    code memory size
+#   ARMPP_BOARD_RAM_ORIGIN      data memory start
+#   ARMPP_BOARD_RAM_LENGTH      data memory size
+#   ARMPP_BOARD_FREE_IRQ        interrupt line that is not connected to a peripheral
+#   ARMPP_BOARD_QEMU_MACHINE    QEMU machine name, empty if the board isn't emulated
+#   ARMPP_BOARD_QEMU_CPU        QEMU cpu name
+
+set(ARMPP_BOARD mps2-an385)
+
+set(TARGET_PROCESSOR cortex-m3)
+set(ARMPP_BOARD_DESCRIPTOR mps2_an385)
+
+set(ARMPP_BOARD_CLOCK_HZ 25000000)
+
+set(ARMPP_BOARD_FLASH_ORIGIN 0x00000000)
+set(ARMPP_BOARD_FLASH_LENGTH 4M)
+set(ARMPP_BOARD_RAM_ORIGIN 0x20000000)
+set(ARMPP_BOARD_RAM_LENGTH 4M)
+
+set(ARMPP_BOARD_FREE_IRQ 31)
+
+set(ARMPP_BOARD_QEMU_MACHINE mps2-an385)
+set(ARMPP_BOARD_QEMU_CPU cortex-m3)
@@ -2,16 +2,31 @@
 # Params:
 #   TARGET_NAME     the name of target
 #   LINKER_SCRIPT   script for linking the target
+#   RAM_REGION      memory region for the code placed with ARMPP_RAMFUNC, RAM by default
+#   FLASH_REGION    memory region the RAM code is loaded from, FLASH by default
 #   SOURCES         source files for the target
 #   INCLUDE_DIRS    include directories
 #   LINK_TARGETS    link libraries that were created with add_library
 #   LINK_LIBRARIES  link libraries
+#   FOOTPRINT_BASELINE  JSON footprint report the map file is compared with
+set(ARMPP_CMAKE_DIR ${CMAKE_CURRENT_LIST_DIR})
+
+find_package(Python3 COMPONENTS Interpreter)
+option(ARMPP_FOOTPRINT_FAIL_ON_PULL "Fail the build when exception, RTTI or iostream code is linked" OFF)
+
 function(add_firmware TARGET_NAME)
     set(options)
-    set(one_val_options LINKER_SCRIPT)
+    set(one_val_options LINKER_SCRIPT RAM_REGION FLASH_REGION FOOTPRINT_BASELINE)
     set(multi_val_options SOURCES INCLUDE_DIRS LINK_LIBRARIES LINK_TARGETS)
     cmake_parse_arguments(ADD_FIRMWARE "${options}" "${one_val_options}" "${multi_val_options}" ${ARGN})
 
+    if (NOT ADD_FIRMWARE_RAM_REGION)
+        set(ADD_FIRMWARE_RAM_REGION RAM)
+    endif()
+    if (NOT ADD_FIRMWARE_FLASH_REGION)
+        set(ADD_FIRMWARE_FLASH_REGION FLASH)
+    endif()
+
     message(STATUS "Configure firmware ${TARGET_NAME}${CMAKE_EXECUTABLE_SUFFIX}\n     linker script ${ADD_FIRMWARE_LINKER_SCRIPT}\n     link targets ${ADD_FIRMWARE_LINK_TARGETS}")
 
     add_executable(${TARGET_NAME} ${ADD_FIRMWARE_SOURCES})
@@ -32,6 +47,36 @@ function(add_firmware TARGET_NAME)
         COMMENT "Generating binary file ${TARGET_NAME}.bin"
         BYPRODUCTS ${TARGET_NAME}.bin
     )
+    add_custom_command(
+        TARGET ${TARGET_NAME}
+        POST_BUILD
+        COMMAND ${CMAKE_COMMAND}
+            -DELF=${CMAKE_RUNTIME_OUTPUT_DIRECTORY}/${TARGET_NAME}${CMAKE_EXECUTABLE_SUFFIX_CXX}
+            -DNM=${ARM_NM}
+            -P ${ARMPP_CMAKE_DIR}/ramfunc_report.cmake
+        COMMENT "Code relocated to RAM:"
+    )
+    if (Python3_Interpreter_FOUND)
+        set(FOOTPRINT_OPTIONS --json ${CMAKE_CURRENT_BINARY_DIR}/${TARGET_NAME}.footprint.json)
+        if (ADD_FIRMWARE_FOOTPRINT_BASELINE)
+            list(APPEND FOOTPRINT_OPTIONS --baseline ${ADD_FIRMWARE_FOOTPRINT_BASELINE})
+        endif()
+        if (ARM_CXXFILT)
+            list(APPEND FOOTPRINT_OPTIONS --cxxfilt ${ARM_CXXFILT})
+        endif()
+        if (ARMPP_FOOTPRINT_FAIL_ON_PULL)
+            list(APPEND FOOTPRINT_OPTIONS --fail-on-pull)
+        endif()
+        add_custom_command(
+            TARGET ${TARGET_NAME}
+            POST_BUILD
+            COMMAND ${Python3_EXECUTABLE} ${ARMPP_CMAKE_DIR}/../tools/footprint_report.py
+                ${FOOTPRINT_OPTIONS}
+                ${CMAKE_CURRENT_BINARY_DIR}/${TARGET_NAME}.map
+            COMMENT "Flash and RAM footprint:"
+            BYPRODUCTS ${TARGET_NAME}.footprint.json
+        )
+    endif()
     
     set_target_properties(
         ${TARGET_NAME} PROPERTIES 
@@ -62,6 +107,19 @@ function(add_firmware TARGET_NAME)
         )
     endif()
 
+    # .ramfunc output section, the linker script picks it with `INCLUDE armpp_ramfunc.ld`
+    set(LINKER_INCLUDE_DIR ${CMAKE_CURRENT_BINARY_DIR}/${TARGET_NAME}_ld)
+    configure_file(
+        ${ARMPP_CMAKE_DIR}/armpp_ramfunc.ld.in
+        ${LINKER_INCLUDE_DIR}/armpp_ramfunc.ld
+        @ONLY
+    )
+    target_link_options(
+        ${TARGET_NAME}
+        PRIVATE
+        -L ${LINKER_INCLUDE_DIR}
+    )
+
     if (ADD_FIRMWARE_LINK_LIBRARIES)
         target_link_libraries(${TARGET_NAME} ${ADD_FIRMWARE_LINK_LIBRARIES})
     endif()
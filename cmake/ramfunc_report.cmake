@@ -0,0 +1,42 @@
+# Print the code relocated to RAM with ARMPP_RAMFUNC
+# Params:
+#   ELF     the firmware image
+#   NM      nm executable for the target
+if (NOT ELF OR NOT NM)
+    message(FATAL_ERROR "ELF and NM must be set")
+endif()
+
+execute_process(
+    COMMAND ${NM} --defined-only --print-size --demangle ${ELF}
+    OUTPUT_VARIABLE symbols
+    OUTPUT_STRIP_TRAILING_WHITESPACE
+    COMMAND_ERROR_IS_FATAL ANY
+)
+string(REPLACE "\n" ";" symbols "${symbols}")
+
+set(section_start)
+set(section_end)
+foreach(line ${symbols})
+    if (line MATCHES "^([0-9a-fA-F]+) [a-zA-Z] _sramfunc$")
+        math(EXPR section_start "0x${CMAKE_MATCH_1}")
+    elseif (line MATCHES "^([0-9a-fA-F]+) [a-zA-Z] _eramfunc$")
+        math(EXPR section_end "0x${CMAKE_MATCH_1}")
+    endif()
+endforeach()
+
+if (NOT DEFINED section_start OR "${section_start}" STREQUAL "")
+    message(STATUS "No .ramfunc section in ${ELF}")
+    return()
+endif()
+
+math(EXPR section_size "${section_end} - ${section_start}")
+message(STATUS "Code relocated to RAM: ${section_size} bytes")
+foreach(line ${symbols})
+    if (line MATCHES "^([0-9a-fA-F]+) ([0-9a-fA-F]+) [tT] (.+)$")
+        math(EXPR addr "0x${CMAKE_MATCH_1}")
+        math(EXPR size "0x${CMAKE_MATCH_2}")
+        if (addr GREATER_EQUAL section_start AND addr LESS section_end)
+            message(STATUS "    ${size}\t${CMAKE_MATCH_3}")
+        endif()
+    endif()
+endforeach()
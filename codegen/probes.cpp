@@ -0,0 +1,169 @@
+/**
+ * Code generation probes
+ *
+ * Every function performs a single HAL operation, `tools/codegen_budget.py` disassembles the
+ * object and checks the instruction and byte counts against `budgets.json`. The `c_` functions
+ * are the same operations written the way C code does it, with raw pointers and masks, the armpp
+ * version of an operation must not be larger than its C counterpart.
+ *
+ * The functions are `extern "C"` and `noinline`, so that they survive as separate symbols with
+ * stable names.
+ */
+#include <armpp/board/current.hpp>
+#include <armpp/hal/nvic.hpp>
+#include <armpp/hal/registers.hpp>
+#include <armpp/hal/timer.hpp>
+#include <armpp/hal/uart.hpp>
+
+#include <cstdint>
+
+#define ARMPP_PROBE extern "C" [[gnu::noinline, gnu::used]]
+
+namespace {
+
+using namespace armpp::hal;
+
+constexpr address timer0_address = armpp::board::current::timer0::base_address;
+constexpr address uart0_address  = armpp::board::current::uart0::base_address;
+
+union probe_register {
+    raw_read_write_register_field<4, 8, access_mode::field>         field;
+    raw_read_write_register_field<4, 8, access_mode::bitwise_logic> bits;
+    bool_read_write_register_field<12>                              flag;
+
+    raw_register volatile raw;
+};
+static_assert(sizeof(probe_register) == sizeof(raw_register));
+
+struct probe_device {
+    static constexpr address base_address = timer0_address;
+
+    probe_register reg;
+};
+
+using probe_handle  = static_handle<probe_device>;
+using timer0_handle = static_handle<timer::timer, timer0_address>;
+using uart0_handle  = static_handle<uart::uart, uart0_address>;
+
+template <address Address>
+raw_register volatile*
+c_registers()
+{
+    return reinterpret_cast<raw_register volatile*>(Address);
+}
+
+}    // namespace
+
+//----------------------------------------------------------------------------
+// Register fields
+ARMPP_PROBE void
+armpp_probe_field_set(std::uint32_t value)
+{
+    probe_handle{}->reg.bits = value;
+}
+
+ARMPP_PROBE void
+armpp_probe_field_set_field_mode(std::uint32_t value)
+{
+    probe_handle{}->reg.field = value;
+}
+
+ARMPP_PROBE std::uint32_t
+armpp_probe_field_get()
+{
+    return probe_handle{}->reg.bits;
+}
+
+ARMPP_PROBE void
+armpp_probe_bit_set()
+{
+    probe_handle{}->reg.flag = true;
+}
+
+ARMPP_PROBE void
+armpp_probe_c_field_set(std::uint32_t value)
+{
+    auto reg = c_registers<probe_device::base_address>();
+    *reg     = (*reg & ~(0xffu << 4)) | ((value & 0xffu) << 4);
+}
+
+ARMPP_PROBE std::uint32_t
+armpp_probe_c_field_get()
+{
+    return (*c_registers<probe_device::base_address>() >> 4) & 0xffu;
+}
+
+ARMPP_PROBE void
+armpp_probe_c_bit_set()
+{
+    auto reg = c_registers<probe_device::base_address>();
+    *reg     = *reg | 1u << 12;
+}
+
+//----------------------------------------------------------------------------
+// Read-modify-write of several registers through a snapshot
+ARMPP_PROBE void
+armpp_probe_modify(std::uint32_t reload)
+{
+    timer::timer::snapshot snap{*timer0_handle{}};
+    snap.set_reload(reload);
+    snap.control().interrupt_enable = true;
+    snap.commit();
+}
+
+ARMPP_PROBE void
+armpp_probe_c_modify(std::uint32_t reload)
+{
+    // What the snapshot does: read reload (offset 8), value (4) and control (0), write back the
+    // changed ones in the same order. The value is not changed, it is only read.
+    auto timer0     = c_registers<timer0_address>();
+    auto old_reload = timer0[2];
+    timer0[1];
+    auto old_ctrl = timer0[0];
+    auto ctrl     = old_ctrl | 1u << 3;
+    if (reload != old_reload)
+        timer0[2] = reload;
+    if (ctrl != old_ctrl)
+        timer0[0] = ctrl;
+}
+
+//----------------------------------------------------------------------------
+// NVIC
+ARMPP_PROBE void
+armpp_probe_enable_irq(irqn_t irqn)
+{
+    nvic::nvic_handle{}->enable_irq(irqn);
+}
+
+ARMPP_PROBE void
+armpp_probe_enable_irq_const()
+{
+    nvic::nvic_handle{}->enable_irq(irqn_t{8});
+}
+
+ARMPP_PROBE void
+armpp_probe_c_enable_irq(std::int32_t irqn)
+{
+    auto index = static_cast<std::uint32_t>(irqn);
+    c_registers<nvic::nvic_registers::iser_base>()[index >> 5] = 1u << (index & 31);
+}
+
+//----------------------------------------------------------------------------
+// UART
+ARMPP_PROBE void
+armpp_probe_put(char c)
+{
+    uart0_handle{}->put(c);
+}
+
+ARMPP_PROBE void
+armpp_probe_c_put(char c)
+{
+    // state is at offset 4, bit 0 is TX buffer full
+    auto uart0 = c_registers<uart0_address>();
+    while (uart0[1] & 1u)
+        ;
+    uart0[0] = static_cast<std::uint8_t>(c);
+}
+
+// uart::configure is out of line, budgets.json refers to the library symbol
@@ -0,0 +1,214 @@
+#pragma once
+
+#include <armpp/hal/common_types.hpp>
+#include <armpp/hal/handle_base.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+
+/**
+ * @namespace armpp::board
+ * @brief Compile-time board descriptors
+ *
+ * A board descriptor is a struct listing the peripheral instances of a SoC or a board: the device
+ * type, the base address, the clock the peripheral runs from and the IRQ lines. The drivers take
+ * their instance tables, handles and interrupt handler bindings from the descriptor, so adding a
+ * board takes a new descriptor header and no changes to the driver sources.
+ *
+ * ```c++
+ * struct my_board {
+ *     static constexpr std::string_view name      = "My board";
+ *     static constexpr std::size_t      irq_count = 32;
+ *
+ *     static constexpr std::uint32_t
+ *     clock_divider(clock_source) { return 1; }
+ *
+ *     using uart0 = peripheral<hal::uart::uart, 0x40004000, clock_source::apb1, hal::irqn_t{0}>;
+ *     using uarts  = peripheral_list<uart0>;
+ *     using timers = peripheral_list<>;
+ *
+ *     using peripherals       = peripheral_list<uart0>;
+ *     using shared_interrupts = interrupt_list<>;
+ * };
+ * ```
+ *
+ * The descriptor the library is built for is `armpp::board::current`, see `current.hpp`.
+ */
+namespace armpp::board {
+
+using vector = void (*)();
+
+/**
+ * @brief Clock a peripheral runs from, the board converts it to a divider of the core clock
+ */
+enum class clock_source { core, apb1, apb2 };
+
+/**
+ * @brief Peripheral instance
+ *
+ * When the device type has a static `interrupt_handler<Address>()` function, it is bound to all
+ * the IRQ lines of the instance by `make_irq_vectors`.
+ *
+ * @tparam Device  Device type
+ * @tparam Address Base address of the instance
+ * @tparam Clock   Clock the instance runs from
+ * @tparam Irqs    IRQ lines of the instance
+ */
+template <typename Device, hal::address Address, clock_source Clock, hal::irqn_t... Irqs>
+struct peripheral {
+    using device_type = Device;
+    using handle_type = hal::static_handle<Device, Address>;
+
+    static constexpr hal::address                            base_address = Address;
+    static constexpr clock_source                            clock        = Clock;
+    static constexpr std::array<hal::irqn_t, sizeof...(Irqs)> irqs{Irqs...};
+
+    static constexpr vector handler = [] {
+        if constexpr (requires { &Device::template interrupt_handler<Address>; }) {
+            return &Device::template interrupt_handler<Address>;
+        } else {
+            return vector{nullptr};
+        }
+    }();
+
+    static device_type&
+    device() noexcept
+    {
+        return handle_type::device();
+    }
+};
+
+/**
+ * @brief Interrupt line shared by several instances, bound to a handler serving all of them
+ */
+template <hal::irqn_t Irqn, vector Handler>
+struct shared_interrupt {
+    static constexpr hal::irqn_t irqn    = Irqn;
+    static constexpr vector      handler = Handler;
+};
+
+/**
+ * @brief Ordered list of peripheral instances
+ */
+template <typename... Peripherals>
+struct peripheral_list {
+    static constexpr std::size_t size = sizeof...(Peripherals);
+    static constexpr std::size_t npos = size;
+
+    template <std::size_t I>
+    using at = std::tuple_element_t<I, std::tuple<Peripherals...>>;
+
+    static constexpr std::array<hal::address, size> addresses{Peripherals::base_address...};
+
+    /**
+     * @brief Index of the instance at a base address, `npos` if there is none
+     */
+    static constexpr std::size_t
+    index_of(hal::address addr) noexcept
+    {
+        for (std::size_t i = 0; i < size; ++i) {
+            if (addresses[i] == addr) {
+                return i;
+            }
+        }
+        return npos;
+    }
+
+    /**
+     * @brief Index of the instance of a device object, `npos` if there is none
+     *
+     * Works for the simulated peripherals as well, the objects are compared, not the addresses.
+     */
+    template <typename Device>
+    static std::size_t
+    index_of(Device const* device) noexcept
+    {
+        for (std::size_t i = 0; i < size; ++i) {
+            if (&hal::device_at<Device>(addresses[i]) == device) {
+                return i;
+            }
+        }
+        return npos;
+    }
+
+    /**
+     * @brief Call `func.template operator()<Peripheral>()` for every instance, in order
+     */
+    template <typename Func>
+    static constexpr void
+    for_each(Func&& func)
+    {
+        (func.template operator()<Peripherals>(), ...);
+    }
+};
+
+template <typename... Interrupts>
+struct interrupt_list {
+    template <typename Func>
+    static constexpr void
+    for_each(Func&& func)
+    {
+        (func.template operator()<Interrupts>(), ...);
+    }
+};
+
+namespace detail {
+
+template <typename Board>
+constexpr bool
+irq_bindings_valid()
+{
+    std::array<bool, Board::irq_count> bound{};
+    bool                               valid = true;
+
+    auto bind = [&](hal::irqn_t irqn) {
+        auto index = static_cast<std::int32_t>(irqn);
+        if (index < 0 || static_cast<std::size_t>(index) >= Board::irq_count || bound[index]) {
+            valid = false;
+        } else {
+            bound[index] = true;
+        }
+    };
+    Board::peripherals::for_each([&]<typename Peripheral>() {
+        for (auto irqn : Peripheral::irqs) {
+            bind(irqn);
+        }
+    });
+    Board::shared_interrupts::for_each([&]<typename Interrupt>() { bind(Interrupt::irqn); });
+    return valid;
+}
+
+}    // namespace detail
+
+/**
+ * @brief External interrupt vectors of a board
+ *
+ * The lines of the peripherals with a driver handler and the shared interrupts are bound to the
+ * driver handlers, the rest to `default_handler`. The firmware vector table places the array
+ * after the 16 system exception vectors, the application may rebind entries before that.
+ */
+template <typename Board>
+constexpr std::array<vector, Board::irq_count>
+make_irq_vectors(vector default_handler)
+{
+    static_assert(detail::irq_bindings_valid<Board>(),
+                  "An IRQ line of the board descriptor is out of range or bound twice");
+
+    std::array<vector, Board::irq_count> vectors{};
+    vectors.fill(default_handler);
+    Board::peripherals::for_each([&]<typename Peripheral>() {
+        if constexpr (Peripheral::handler != nullptr) {
+            for (auto irqn : Peripheral::irqs) {
+                vectors[static_cast<std::size_t>(irqn)] = Peripheral::handler;
+            }
+        }
+    });
+    Board::shared_interrupts::for_each([&]<typename Interrupt>() {
+        vectors[static_cast<std::size_t>(Interrupt::irqn)] = Interrupt::handler;
+    });
+    return vectors;
+}
+
+}    // namespace armpp::board
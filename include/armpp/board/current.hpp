@@ -0,0 +1,22 @@
+#pragma once
+
+/**
+ * @file
+ * @brief Board descriptor the library is built for
+ *
+ * The build passes the descriptor header and type with `ARMPP_BOARD_HEADER` and
+ * `ARMPP_BOARD_TYPE`, set from `ARMPP_BOARD_DESCRIPTOR` of the board profile. Without them the
+ * Gowin EMPU descriptor is used.
+ */
+#if defined(ARMPP_BOARD_HEADER)
+#    include ARMPP_BOARD_HEADER
+#else
+#    include <armpp/board/gowin_empu.hpp>
+#    define ARMPP_BOARD_TYPE armpp::board::gowin_empu
+#endif
+
+namespace armpp::board {
+
+using current = ARMPP_BOARD_TYPE;
+
+}    // namespace armpp::board
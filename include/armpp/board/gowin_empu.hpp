@@ -0,0 +1,49 @@
+#pragma once
+
+#include <armpp/board/board.hpp>
+#include <armpp/hal/timer.hpp>
+#include <armpp/hal/uart.hpp>
+
+#include <string_view>
+
+namespace armpp::board {
+
+/**
+ * @brief Gowin EMPU, the Cortex-M3 hard core of the GW1NS(R)-4C FPGAs
+ *
+ * The peripherals follow the ARM CMSDK layout on the APB1 bus, which runs at the core clock.
+ * Each UART has a single IRQ line for RX and TX, the overrun interrupts of both share one line.
+ */
+struct gowin_empu {
+    static constexpr std::string_view name      = "Gowin EMPU";
+    static constexpr std::size_t      irq_count = 32;
+
+    static constexpr hal::address apb1_base = 0x40000000;
+    static constexpr hal::address apb2_base = apb1_base + 0x02000;
+
+    static constexpr std::uint32_t
+    clock_divider(clock_source) noexcept
+    {
+        return 1;
+    }
+
+    using timer0 = peripheral<hal::timer::timer, apb1_base + 0x0000, clock_source::apb1,
+                              hal::irqn_t{8}>;
+    using timer1 = peripheral<hal::timer::timer, apb1_base + 0x1000, clock_source::apb1,
+                              hal::irqn_t{9}>;
+    using uart0
+        = peripheral<hal::uart::uart, apb1_base + 0x4000, clock_source::apb1, hal::irqn_t{0}>;
+    using uart1
+        = peripheral<hal::uart::uart, apb1_base + 0x5000, clock_source::apb1, hal::irqn_t{1}>;
+
+    using uarts  = peripheral_list<uart0, uart1>;
+    using timers = peripheral_list<timer0, timer1>;
+
+    using peripherals = peripheral_list<timer0, timer1, uart0, uart1>;
+    using shared_interrupts
+        = interrupt_list<shared_interrupt<hal::irqn_t{12},
+                                          &hal::uart::uart::overrun_interrupt_handler<
+                                              uart0::base_address, uart1::base_address>>>;
+};
+
+}    // namespace armpp::board
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <armpp/board/board.hpp>
+#include <armpp/hal/timer.hpp>
+#include <armpp/hal/uart.hpp>
+
+#include <string_view>
+
+namespace armpp::board {
+
+/**
+ * @brief ARM MPS2 FPGA prototyping board with the AN385 Cortex-M3 image, emulated by QEMU
+ *
+ * CMSDK peripherals on APB at the core clock. The UARTs have separate RX and TX lines, the
+ * overrun interrupts of all the UARTs share one line.
+ */
+struct mps2_an385 {
+    static constexpr std::string_view name      = "ARM MPS2 AN385";
+    static constexpr std::size_t      irq_count = 32;
+
+    static constexpr std::uint32_t
+    clock_divider(clock_source) noexcept
+    {
+        return 1;
+    }
+
+    using timer0 = peripheral<hal::timer::timer, 0x40000000, clock_source::apb1, hal::irqn_t{8}>;
+    using timer1 = peripheral<hal::timer::timer, 0x40001000, clock_source::apb1, hal::irqn_t{9}>;
+    using uart0  = peripheral<hal::uart::uart, 0x40004000, clock_source::apb1, hal::irqn_t{0},
+                              hal::irqn_t{1}>;
+    using uart1  = peripheral<hal::uart::uart, 0x40005000, clock_source::apb1, hal::irqn_t{2},
+                              hal::irqn_t{3}>;
+    using uart2  = peripheral<hal::uart::uart, 0x40006000, clock_source::apb1, hal::irqn_t{4},
+                              hal::irqn_t{5}>;
+
+    using uarts  = peripheral_list<uart0, uart1, uart2>;
+    using timers = peripheral_list<timer0, timer1>;
+
+    using peripherals = peripheral_list<timer0, timer1, uart0, uart1, uart2>;
+    using shared_interrupts
+        = interrupt_list<shared_interrupt<hal::irqn_t{12},
+                                          &hal::uart::uart::overrun_interrupt_handler<
+                                              uart0::base_address, uart1::base_address,
+                                              uart2::base_address>>>;
+};
+
+}    // namespace armpp::board
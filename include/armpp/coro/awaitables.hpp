@@ -0,0 +1,159 @@
+#pragma once
+
+#include <armpp/coro/executor.hpp>
+
+#include <chrono>
+#include <concepts>
+#include <coroutine>
+#include <type_traits>
+#include <utility>
+
+namespace armpp::coro {
+
+/**
+ * @class sleep_awaiter
+ * @brief Suspends the coroutine until the system clock reaches the deadline
+ */
+class sleep_awaiter {
+public:
+    using clock      = hal::system::clock;
+    using time_point = clock::time_point;
+
+public:
+    explicit sleep_awaiter(time_point deadline) noexcept : node_{.deadline = deadline} {}
+
+    bool
+    await_ready() const noexcept
+    {
+        return clock::now() >= node_.deadline;
+    }
+
+    void
+    await_suspend(std::coroutine_handle<> handle) noexcept
+    {
+        node_.handle = handle;
+        executor::instance().add_sleeper(node_);
+    }
+
+    void
+    await_resume() const noexcept
+    {}
+
+private:
+    sleep_node node_;
+};
+
+/**
+ * @brief Suspend the coroutine until the time point
+ *
+ * Resolution is one system clock tick (millisecond).
+ */
+inline sleep_awaiter
+sleep_until(hal::system::clock::time_point deadline) noexcept
+{
+    return sleep_awaiter{deadline};
+}
+
+/**
+ * @brief Suspend the coroutine for the duration
+ *
+ * Resolution is one system clock tick (millisecond).
+ */
+template <typename Rep, typename Period>
+sleep_awaiter
+sleep_for(std::chrono::duration<Rep, Period> const& dur) noexcept
+{
+    using clock = hal::system::clock;
+    return sleep_awaiter{clock::now() + std::chrono::duration_cast<clock::duration>(dur)};
+}
+
+/**
+ * @class predicate_awaiter
+ * @brief Suspends the coroutine until the predicate returns true
+ *
+ * The predicate is checked once when awaited and then on every pass of the executor. Every
+ * interrupt wakes the executor, so a predicate over a peripheral register is re-evaluated right
+ * after the interrupt that could change it.
+ */
+template <std::predicate Predicate>
+class predicate_awaiter {
+public:
+    explicit predicate_awaiter(Predicate pred) noexcept(
+        std::is_nothrow_move_constructible_v<Predicate>)
+        : pred_{std::move(pred)}
+    {}
+
+    bool
+    await_ready()
+    {
+        return pred_();
+    }
+
+    void
+    await_suspend(std::coroutine_handle<> handle) noexcept
+    {
+        node_.predicate = &predicate_awaiter::check;
+        node_.context   = this;
+        node_.handle    = handle;
+        executor::instance().add_poller(node_);
+    }
+
+    void
+    await_resume() const noexcept
+    {}
+
+private:
+    static bool
+    check(void* self)
+    {
+        return static_cast<predicate_awaiter*>(self)->pred_();
+    }
+
+private:
+    Predicate pred_;
+    poll_node node_;
+};
+
+/**
+ * @brief Suspend the coroutine until the predicate is true
+ *
+ * ```c++
+ * co_await coro::wait_until([&] { return !uart0->tx_buffer_full(); });
+ * ```
+ */
+template <std::predicate Predicate>
+predicate_awaiter<std::decay_t<Predicate>>
+wait_until(Predicate&& pred)
+{
+    return predicate_awaiter<std::decay_t<Predicate>>{std::forward<Predicate>(pred)};
+}
+
+/**
+ * @brief Yield to the other ready coroutines
+ */
+struct yield_awaiter {
+    bool
+    await_ready() const noexcept
+    {
+        return false;
+    }
+
+    bool
+    await_suspend(std::coroutine_handle<> handle) const noexcept
+    {
+        // If the ready queue is full, just continue
+        return executor::instance().post(handle);
+    }
+
+    void
+    await_resume() const noexcept
+    {}
+};
+
+inline yield_awaiter
+yield() noexcept
+{
+    return {};
+}
+
+}    // namespace armpp::coro
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <armpp/coro/executor.hpp>
+#include <armpp/hal/cpu.hpp>
+
+#include <coroutine>
+
+namespace armpp::coro {
+
+/**
+ * @class event
+ * @brief Auto-reset event a single coroutine can wait for
+ *
+ * `notify` can be called from interrupt handlers, it posts the waiting coroutine to the executor.
+ * If no coroutine is waiting, the event stays set and the next `wait` completes immediately.
+ *
+ * The event is a wake policy for `util::spsc_queue` and `util::mpsc_queue`:
+ *
+ * ```c++
+ * armpp::util::spsc_queue<char, 64, armpp::coro::event> rx_queue;
+ *
+ * armpp::coro::task<>
+ * consume()
+ * {
+ *     char buffer[16];
+ *     while (true) {
+ *         co_await rx_queue.waker().wait();
+ *         while (auto n = rx_queue.pop(buffer)) {
+ *             process(std::span{buffer, n});
+ *         }
+ *     }
+ * }
+ * ```
+ */
+class event {
+public:
+    class awaiter {
+    public:
+        explicit awaiter(event& ev) noexcept : event_{ev} {}
+
+        bool
+        await_ready() const noexcept
+        {
+            hal::cpu::critical_section cs;
+            return event_.consume();
+        }
+
+        bool
+        await_suspend(std::coroutine_handle<> handle) noexcept
+        {
+            hal::cpu::critical_section cs;
+            // Notified between await_ready and await_suspend
+            if (event_.consume())
+                return false;
+            event_.waiter_ = handle;
+            return true;
+        }
+
+        void
+        await_resume() const noexcept
+        {}
+
+    private:
+        event& event_;
+    };
+
+public:
+    constexpr event() noexcept = default;
+
+    event(event const&) = delete;
+    event(event&&)      = delete;
+
+    event&
+    operator=(event const&)
+        = delete;
+    event&
+    operator=(event&&)
+        = delete;
+
+    /**
+     * @brief Set the event, resume the waiting coroutine if any
+     *
+     * If the executor ready queue is full, the coroutine stays waiting and the event set, it is
+     * resumed by the next notification.
+     */
+    void
+    notify() noexcept
+    {
+        hal::cpu::critical_section cs;
+        if (waiter_ && executor::instance().post(waiter_)) {
+            waiter_ = nullptr;
+        } else {
+            set_ = true;
+        }
+    }
+
+    awaiter
+    wait() noexcept
+    {
+        return awaiter{*this};
+    }
+
+    bool
+    is_set() const noexcept
+    {
+        return set_;
+    }
+
+private:
+    bool
+    consume() noexcept
+    {
+        bool was_set = set_;
+        set_         = false;
+        return was_set;
+    }
+
+private:
+    std::coroutine_handle<> waiter_ = nullptr;
+    bool volatile set_              = false;
+};
+
+}    // namespace armpp::coro
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <armpp/coro/task.hpp>
+#include <armpp/hal/system.hpp>
+#include <armpp/util/message_queue.hpp>
+
+#include <coroutine>
+#include <cstddef>
+
+#ifndef ARMPP_CORO_READY_QUEUE_SIZE
+#    define ARMPP_CORO_READY_QUEUE_SIZE 16
+#endif
+
+namespace armpp::coro {
+
+/**
+ * @brief Node of the executor sleep queue
+ *
+ * Nodes are members of awaiters, so they live in the suspended coroutine frame.
+ */
+struct sleep_node {
+    using time_point = hal::system::clock::time_point;
+
+    time_point              deadline;
+    std::coroutine_handle<> handle = nullptr;
+    sleep_node*             next   = nullptr;
+};
+
+/**
+ * @brief Node of the executor poll list
+ */
+struct poll_node {
+    using predicate_type = bool (*)(void*);
+
+    predicate_type          predicate = nullptr;
+    void*                   context   = nullptr;
+    std::coroutine_handle<> handle    = nullptr;
+    poll_node*              next      = nullptr;
+};
+
+/**
+ * @class executor
+ * @brief Cooperative single threaded coroutine executor
+ *
+ * Coroutines are resumed from `run` or `run_once` in thread mode. Interrupt handlers never resume a
+ * coroutine directly, they `post` its handle to the ready queue, so the ISR stays short and the
+ * coroutine continues after the exception returns.
+ *
+ * Sleeping coroutines are kept in a deadline ordered list which is checked against
+ * `system::clock` on every pass, coroutines waiting for a predicate are polled on every pass. When
+ * there is nothing to run the core waits for an interrupt, so a SysTick or a peripheral interrupt
+ * is what wakes the executor.
+ *
+ * The ready queue is a lock-free `util::mpsc_queue`, so posting from an interrupt handler never
+ * masks interrupts. The sleep and poll lists are touched only from coroutines, that is from thread
+ * mode, so they are not protected.
+ */
+class executor {
+public:
+    static constexpr std::size_t ready_queue_size = ARMPP_CORO_READY_QUEUE_SIZE;
+
+public:
+    constexpr executor() noexcept = default;
+
+    executor(executor const&) = delete;
+    executor(executor&&)      = delete;
+
+    executor&
+    operator=(executor const&)
+        = delete;
+    executor&
+    operator=(executor&&)
+        = delete;
+
+    /**
+     * @brief Start a top-level task
+     *
+     * The executor takes ownership of the task, the coroutine frame is returned to the pool when it
+     * finishes.
+     *
+     * @return false if the task is empty (frame allocation failed) or the ready queue is full
+     */
+    bool
+    spawn(task<void>&& t) noexcept;
+
+    /**
+     * @brief Schedule a suspended coroutine for resumption
+     *
+     * Safe to call from interrupt handlers.
+     *
+     * @return false if the ready queue is full
+     */
+    bool
+    post(std::coroutine_handle<> handle) noexcept;
+
+    /**
+     * @brief Put the coroutine to the sleep queue
+     */
+    void
+    add_sleeper(sleep_node& node) noexcept;
+
+    /**
+     * @brief Put the coroutine to the poll list
+     */
+    void
+    add_poller(poll_node& node) noexcept;
+
+    /**
+     * @brief Run all coroutines that are ready
+     * @return true if there are coroutines that are not finished yet
+     */
+    bool
+    run_once() noexcept;
+
+    /**
+     * @brief Run coroutines forever, sleep between interrupts when idle
+     */
+    [[noreturn]] void
+    run() noexcept;
+
+    /**
+     * @brief Check if no coroutine is ready, sleeping or waiting for a predicate
+     */
+    bool
+    idle() const noexcept
+    {
+        return ready_.empty() && !sleepers_ && !pollers_;
+    }
+
+    static executor&
+    instance() noexcept;
+
+private:
+    void
+    wake_sleepers() noexcept;
+
+    void
+    poll() noexcept;
+
+private:
+    using ready_queue = util::mpsc_queue<std::coroutine_handle<>, ready_queue_size>;
+
+    ready_queue ready_;
+    sleep_node* sleepers_ = nullptr;
+    poll_node*  pollers_  = nullptr;
+};
+
+}    // namespace armpp::coro
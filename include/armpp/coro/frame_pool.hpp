@@ -0,0 +1,38 @@
+#pragma once
+
+#include <armpp/util/pool_allocator.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+#ifndef ARMPP_CORO_FRAME_SIZE
+#    define ARMPP_CORO_FRAME_SIZE 256
+#endif
+
+#ifndef ARMPP_CORO_FRAME_COUNT
+#    define ARMPP_CORO_FRAME_COUNT 8
+#endif
+
+namespace armpp::coro {
+
+/**
+ * @brief Statically allocated pool of fixed size blocks for coroutine frames
+ *
+ * Allocation and deallocation mask interrupts for a few instructions, so a coroutine can be started
+ * from an interrupt handler.
+ *
+ * @tparam BlockSize Size of a single block, rounded up to the max alignment
+ * @tparam BlockCount Number of blocks in the pool
+ */
+template <std::size_t BlockSize, std::size_t BlockCount>
+using frame_pool = util::fixed_pool<BlockSize, BlockCount, util::pool_sync::interrupt_mask>;
+
+using default_frame_pool = frame_pool<ARMPP_CORO_FRAME_SIZE, ARMPP_CORO_FRAME_COUNT>;
+
+/**
+ * @brief The pool used by promise_type::operator new
+ */
+default_frame_pool&
+frame_pool_instance() noexcept;
+
+}    // namespace armpp::coro
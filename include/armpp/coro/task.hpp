@@ -0,0 +1,261 @@
+#pragma once
+
+#include <armpp/coro/frame_pool.hpp>
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+
+namespace armpp::coro {
+
+template <typename T>
+class task;
+
+namespace detail {
+
+/**
+ * @brief Common part of task promises
+ *
+ * Allocates the coroutine frames from the frame pool. If the pool is exhausted the coroutine
+ * function returns an empty task instead of calling the heap.
+ */
+struct promise_base {
+    struct final_awaiter {
+        bool
+        await_ready() const noexcept
+        {
+            return false;
+        }
+
+        template <typename Promise>
+        std::coroutine_handle<>
+        await_suspend(std::coroutine_handle<Promise> handle) noexcept
+        {
+            auto& promise = handle.promise();
+            if (promise.continuation_) {
+                return promise.continuation_;
+            }
+            if (promise.detached_) {
+                handle.destroy();
+            }
+            return std::noop_coroutine();
+        }
+
+        void
+        await_resume() const noexcept
+        {}
+    };
+
+    static void*
+    operator new(std::size_t size) noexcept
+    {
+        return frame_pool_instance().allocate(size);
+    }
+
+    static void
+    operator delete(void* ptr) noexcept
+    {
+        frame_pool_instance().deallocate(ptr);
+    }
+
+    std::suspend_always
+    initial_suspend() const noexcept
+    {
+        return {};
+    }
+
+    final_awaiter
+    final_suspend() const noexcept
+    {
+        return {};
+    }
+
+    void
+    unhandled_exception() const noexcept
+    {
+        std::terminate();
+    }
+
+    std::coroutine_handle<> continuation_ = nullptr;
+    bool                    detached_     = false;
+};
+
+template <typename T>
+struct promise : promise_base {
+    task<T>
+    get_return_object() noexcept;
+
+    static task<T>
+    get_return_object_on_allocation_failure() noexcept;
+
+    template <typename U>
+    void
+    return_value(U&& value)
+    {
+        value_.emplace(std::forward<U>(value));
+    }
+
+    std::optional<T> value_;
+};
+
+template <>
+struct promise<void> : promise_base {
+    task<void>
+    get_return_object() noexcept;
+
+    static task<void>
+    get_return_object_on_allocation_failure() noexcept;
+
+    void
+    return_void() const noexcept
+    {}
+};
+
+}    // namespace detail
+
+/**
+ * @class task
+ * @brief Lazily started coroutine
+ *
+ * A task starts when it is awaited from another coroutine or when it is passed to
+ * `executor::spawn`. Awaiting a task transfers control to it symmetrically, so chains of nested
+ * tasks don't grow the stack.
+ *
+ * @tparam T Type of the value returned with co_return
+ */
+template <typename T = void>
+class task {
+public:
+    using promise_type = detail::promise<T>;
+    using handle_type  = std::coroutine_handle<promise_type>;
+
+public:
+    constexpr task() noexcept = default;
+    explicit task(handle_type handle) noexcept : handle_{handle} {}
+
+    task(task const&) = delete;
+    task(task&& rhs) noexcept : handle_{std::exchange(rhs.handle_, nullptr)} {}
+
+    ~task()
+    {
+        if (handle_)
+            handle_.destroy();
+    }
+
+    task&
+    operator=(task const&)
+        = delete;
+    task&
+    operator=(task&& rhs) noexcept
+    {
+        if (this != &rhs) {
+            if (handle_)
+                handle_.destroy();
+            handle_ = std::exchange(rhs.handle_, nullptr);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Check if the coroutine frame was allocated
+     */
+    explicit
+    operator bool() const noexcept
+    {
+        return static_cast<bool>(handle_);
+    }
+
+    bool
+    done() const noexcept
+    {
+        return !handle_ || handle_.done();
+    }
+
+    /**
+     * @brief Release ownership of the coroutine
+     *
+     * The frame destroys itself when the coroutine finishes.
+     */
+    handle_type
+    detach() noexcept
+    {
+        if (handle_)
+            handle_.promise().detached_ = true;
+        return std::exchange(handle_, nullptr);
+    }
+
+    /**
+     * @brief Run the task in the awaiting coroutine and get its result
+     *
+     * An empty task, returned when the frame pool is exhausted, doesn't run. Awaiting an empty
+     * `task<void>` completes at once, awaiting an empty task with a value traps, there is no value
+     * to return. Check the task with `operator bool` before awaiting it where the pool can run out.
+     */
+    auto
+    operator co_await() && noexcept
+    {
+        struct awaiter {
+            handle_type handle_;
+
+            bool
+            await_ready() const noexcept
+            {
+                return !handle_ || handle_.done();
+            }
+
+            std::coroutine_handle<>
+            await_suspend(std::coroutine_handle<> continuation) noexcept
+            {
+                handle_.promise().continuation_ = continuation;
+                return handle_;
+            }
+
+            decltype(auto)
+            await_resume()
+            {
+                if constexpr (!std::is_void_v<T>) {
+                    if (!handle_)
+                        __builtin_trap();
+                    return std::move(*handle_.promise().value_);
+                }
+            }
+        };
+        return awaiter{handle_};
+    }
+
+private:
+    handle_type handle_ = nullptr;
+};
+
+namespace detail {
+
+template <typename T>
+task<T>
+promise<T>::get_return_object() noexcept
+{
+    return task<T>{task<T>::handle_type::from_promise(*this)};
+}
+
+template <typename T>
+task<T>
+promise<T>::get_return_object_on_allocation_failure() noexcept
+{
+    return task<T>{};
+}
+
+inline task<void>
+promise<void>::get_return_object() noexcept
+{
+    return task<void>{task<void>::handle_type::from_promise(*this)};
+}
+
+inline task<void>
+promise<void>::get_return_object_on_allocation_failure() noexcept
+{
+    return task<void>{};
+}
+
+}    // namespace detail
+
+}    // namespace armpp::coro
@@ -0,0 +1,266 @@
+#pragma once
+
+#include <armpp/coro/executor.hpp>
+#include <armpp/hal/uart.hpp>
+
+#include <coroutine>
+#include <cstddef>
+#include <string_view>
+
+namespace armpp::coro {
+
+/**
+ * @class async_uart
+ * @brief Awaitable reads and writes over a UART device
+ *
+ * The object installs RX and TX handlers to the device, the UART must be configured with RX and
+ * TX interrupts enabled. A character received while no coroutine is waiting is latched, if one
+ * more arrives before it is read the former is lost and the overrun counter is incremented.
+ * If the executor ready queue is full, a finished waiter stays registered, the character it
+ * would get stays latched, and the coroutine is resumed on the next interrupt of the UART.
+ *
+ * Only one reader and one writer can wait at a time.
+ *
+ * ```c++
+ * coro::task<>
+ * echo(coro::async_uart& port)
+ * {
+ *     while (true) {
+ *         char c = co_await port.read();
+ *         co_await port.write(c);
+ *     }
+ * }
+ * ```
+ */
+class async_uart {
+public:
+    using uart_handle = hal::uart::uart_handle;
+
+    class read_awaiter {
+    public:
+        explicit read_awaiter(async_uart& port) noexcept : port_{port} {}
+
+        bool
+        await_ready() noexcept
+        {
+            return port_.try_read(value_);
+        }
+
+        bool
+        await_suspend(std::coroutine_handle<> handle) noexcept
+        {
+            hal::cpu::critical_section cs;
+            if (port_.try_read(value_))
+                return false;
+            handle_       = handle;
+            port_.reader_ = this;
+            return true;
+        }
+
+        char
+        await_resume() const noexcept
+        {
+            return value_;
+        }
+
+    private:
+        friend class async_uart;
+
+        async_uart&             port_;
+        std::coroutine_handle<> handle_ = nullptr;
+        char                    value_  = 0;
+    };
+
+    class write_awaiter {
+    public:
+        write_awaiter(async_uart& port, std::string_view str) noexcept
+            : port_{port}, data_{str.data()}, size_{str.size()}
+        {}
+
+        write_awaiter(async_uart& port, char c) noexcept
+            : port_{port}, data_{nullptr}, size_{1}, single_{c}
+        {}
+
+        bool
+        await_ready() noexcept
+        {
+            if (!data_)
+                data_ = &single_;
+            return port_.push(*this);
+        }
+
+        bool
+        await_suspend(std::coroutine_handle<> handle) noexcept
+        {
+            hal::cpu::critical_section cs;
+            if (port_.push(*this))
+                return false;
+            handle_       = handle;
+            port_.writer_ = this;
+            return true;
+        }
+
+        void
+        await_resume() const noexcept
+        {}
+
+    private:
+        friend class async_uart;
+
+        async_uart&             port_;
+        char const*             data_;
+        std::size_t             size_;
+        char                    single_ = 0;
+        std::coroutine_handle<> handle_ = nullptr;
+    };
+
+public:
+    explicit async_uart(uart_handle& handle) noexcept;
+
+    async_uart(async_uart const&) = delete;
+    async_uart(async_uart&&)      = delete;
+
+    async_uart&
+    operator=(async_uart const&)
+        = delete;
+    async_uart&
+    operator=(async_uart&&)
+        = delete;
+
+    /**
+     * @brief Read a character
+     */
+    read_awaiter
+    read() noexcept
+    {
+        return read_awaiter{*this};
+    }
+
+    /**
+     * @brief Write a character
+     */
+    write_awaiter
+    write(char c) noexcept
+    {
+        return write_awaiter{*this, c};
+    }
+
+    /**
+     * @brief Write a string
+     *
+     * The string must stay valid until the write completes. The characters are fed to the device
+     * from the TX interrupt, the coroutine is resumed once when the last one is written.
+     */
+    write_awaiter
+    write(std::string_view str) noexcept
+    {
+        return write_awaiter{*this, str};
+    }
+
+    /**
+     * @brief Number of received characters lost because nobody was reading
+     */
+    std::size_t
+    overruns() const noexcept
+    {
+        return overruns_;
+    }
+
+private:
+    bool
+    try_read(char& c) noexcept;
+
+    bool
+    push(write_awaiter& writer) noexcept;
+
+    void
+    on_rx(char c) noexcept;
+
+    void
+    on_tx() noexcept;
+
+    /**
+     * @brief Post the waiters that are done, a waiter the ready queue has no room for stays
+     */
+    void
+    resume_waiters() noexcept;
+
+private:
+    uart_handle&            handle_;
+    read_awaiter* volatile  reader_    = nullptr;
+    write_awaiter* volatile writer_    = nullptr;
+    char volatile           latched_   = 0;
+    bool volatile           has_latch_ = false;
+    std::size_t             overruns_  = 0;
+};
+
+inline async_uart::async_uart(uart_handle& handle) noexcept : handle_{handle}
+{
+    handle_->set_rx_handler([this](uart_handle&, char c) { on_rx(c); });
+    handle_->set_tx_handler([this](uart_handle&) { on_tx(); });
+}
+
+inline bool
+async_uart::try_read(char& c) noexcept
+{
+    // The RX handler must not latch a character between the checks
+    hal::cpu::critical_section cs;
+    if (has_latch_) {
+        c          = latched_;
+        has_latch_ = false;
+        return true;
+    }
+    if (handle_->rx_buffer_full()) {
+        c = handle_->get();
+        return true;
+    }
+    return false;
+}
+
+inline bool
+async_uart::push(write_awaiter& writer) noexcept
+{
+    while (writer.size_ > 0 && !handle_->tx_buffer_full()) {
+        handle_->put(*writer.data_++);
+        --writer.size_;
+    }
+    return writer.size_ == 0;
+}
+
+inline void
+async_uart::on_rx(char c) noexcept
+{
+    hal::cpu::critical_section cs;
+    if (has_latch_)
+        ++overruns_;
+    latched_   = c;
+    has_latch_ = true;
+    resume_waiters();
+}
+
+inline void
+async_uart::on_tx() noexcept
+{
+    if (auto writer = writer_; writer)
+        push(*writer);
+    resume_waiters();
+}
+
+inline void
+async_uart::resume_waiters() noexcept
+{
+    // The RX and TX handlers can preempt each other, a waiter must be posted once
+    hal::cpu::critical_section cs;
+    auto&                      exec = executor::instance();
+    if (auto reader = reader_; reader && has_latch_) {
+        reader->value_ = latched_;
+        if (exec.post(reader->handle_)) {
+            reader_    = nullptr;
+            has_latch_ = false;
+        }
+    }
+    if (auto writer = writer_; writer && writer->size_ == 0 && exec.post(writer->handle_))
+        writer_ = nullptr;
+}
+
+}    // namespace armpp::coro
@@ -0,0 +1,193 @@
+#pragma once
+
+#include <armpp/hal/common_types.hpp>
+
+#include <cstdint>
+#include <string_view>
+
+/**
+ * @namespace armpp::hal::core
+ * @brief Compile-time description of the Cortex-M core the code is built for
+ *
+ * The drivers pick the mechanism for an operation from the profile of the current core: bit-band
+ * or read-modify-write, LDREX/STREX or PRIMASK, hardware divide or a division free sequence, DWT
+ * or SysTick cycle counting. Code requesting a feature the core doesn't implement fails to compile
+ * with a static_assert naming the feature.
+ *
+ * The core is taken from the ARMPP_CORE definition (`cortex_m0`, `cortex_m0plus`, `cortex_m3`,
+ * `cortex_m4`, `cortex_m7`) set by the toolchain file from TARGET_PROCESSOR. Without it the
+ * architecture macros of the compiler are used, they cannot tell Cortex-M0+ from Cortex-M0 and
+ * Cortex-M7 from Cortex-M4.
+ */
+namespace armpp::hal::core {
+
+enum class family { cortex_m0, cortex_m0plus, cortex_m3, cortex_m4, cortex_m7, host };
+
+enum class architecture { armv6m, armv7m, armv7em, host };
+
+/**
+ * @brief Features of a core
+ *
+ * The `host` profile is used for the builds outside the target, the instructions compile to
+ * barriers there. It accepts everything the application code may ask for, except the mechanisms
+ * that need the target memory map or hardware (bit-band, exclusive access, DWT).
+ */
+template <family Family>
+struct profile;
+
+template <>
+struct profile<family::cortex_m0> {
+    static constexpr std::string_view name = "Cortex-M0";
+    static constexpr architecture     arch = architecture::armv6m;
+
+    /** Bit-band alias regions for SRAM and peripherals */
+    static constexpr bool bitband = false;
+    /** BASEPRI register masking interrupts by priority */
+    static constexpr bool basepri = false;
+    /** LDREX/STREX exclusive access instructions */
+    static constexpr bool exclusive_access = false;
+    /** UDIV/SDIV instructions */
+    static constexpr bool hardware_divide = false;
+    /** 32x32->64 bit multiply, used for division by a constant */
+    static constexpr bool long_multiply = false;
+    /** CLZ and RBIT instructions */
+    static constexpr bool bit_scan = false;
+    /** DWT cycle counter, may still be left out by the silicon vendor */
+    static constexpr bool cycle_counter = false;
+    /** Data and instruction caches */
+    static constexpr bool cache = false;
+    /** Maximum number of external interrupts */
+    static constexpr std::uint32_t max_irq_count = 32;
+};
+
+template <>
+struct profile<family::cortex_m0plus> : profile<family::cortex_m0> {
+    static constexpr std::string_view name = "Cortex-M0+";
+};
+
+template <>
+struct profile<family::cortex_m3> {
+    static constexpr std::string_view name = "Cortex-M3";
+    static constexpr architecture     arch = architecture::armv7m;
+
+    static constexpr bool          bitband          = true;
+    static constexpr bool          basepri          = true;
+    static constexpr bool          exclusive_access = true;
+    static constexpr bool          hardware_divide  = true;
+    static constexpr bool          long_multiply    = true;
+    static constexpr bool          bit_scan         = true;
+    static constexpr bool          cycle_counter    = true;
+    static constexpr bool          cache            = false;
+    static constexpr std::uint32_t max_irq_count    = 240;
+};
+
+template <>
+struct profile<family::cortex_m4> : profile<family::cortex_m3> {
+    static constexpr std::string_view name = "Cortex-M4";
+    static constexpr architecture     arch = architecture::armv7em;
+};
+
+template <>
+struct profile<family::cortex_m7> : profile<family::cortex_m4> {
+    static constexpr std::string_view name = "Cortex-M7";
+
+    static constexpr bool bitband = false;
+    static constexpr bool cache   = true;
+};
+
+template <>
+struct profile<family::host> {
+    static constexpr std::string_view name = "host";
+    static constexpr architecture     arch = architecture::host;
+
+    static constexpr bool          bitband          = false;
+    static constexpr bool          basepri          = true;
+    static constexpr bool          exclusive_access = false;
+    static constexpr bool          hardware_divide  = true;
+    static constexpr bool          long_multiply    = true;
+    static constexpr bool          bit_scan         = true;
+    static constexpr bool          cycle_counter    = false;
+    static constexpr bool          cache            = false;
+    static constexpr std::uint32_t max_irq_count    = 240;
+};
+
+/**
+ * @brief The code runs on a Cortex-M core, false for the host builds
+ */
+#if defined(__arm__)
+constexpr bool on_target = true;
+#else
+constexpr bool on_target = false;
+#endif
+
+#if defined(ARMPP_CORE)
+constexpr family current_family = family::ARMPP_CORE;
+#elif defined(__ARM_ARCH_6M__)
+constexpr family current_family = family::cortex_m0;
+#elif defined(__ARM_ARCH_7M__)
+constexpr family current_family = family::cortex_m3;
+#elif defined(__ARM_ARCH_7EM__)
+constexpr family current_family = family::cortex_m4;
+#else
+constexpr family current_family = family::host;
+#endif
+
+/**
+ * @brief Profile of the core the code is built for
+ */
+using current = profile<current_family>;
+
+static_assert(!on_target || current::arch != architecture::host,
+              "ARMPP_CORE names the host profile in a target build");
+
+//----------------------------------------------------------------------------
+// Bit-band
+/**
+ * @brief Bit-band region and its alias
+ */
+struct bitband_region {
+    address begin;
+    address end;
+    address alias;
+};
+
+constexpr bitband_region sram_bitband{0x20000000, 0x20100000, 0x22000000};
+constexpr bitband_region peripheral_bitband{0x40000000, 0x40100000, 0x42000000};
+
+/**
+ * @brief Check if an address is in one of the bit-band regions of the core
+ */
+template <typename Core = current>
+constexpr bool
+bitband_addressable(address addr) noexcept
+{
+    if constexpr (Core::bitband) {
+        return (addr >= sram_bitband.begin && addr < sram_bitband.end)
+            || (addr >= peripheral_bitband.begin && addr < peripheral_bitband.end);
+    } else {
+        return false;
+    }
+}
+
+/**
+ * @brief Address of the alias word of a bit
+ *
+ * Writing 0 or 1 to the alias word clears or sets the single bit in one bus transaction,
+ * reading it returns the bit value.
+ */
+template <typename Core = current>
+constexpr address
+bitband_alias(address addr, std::uint32_t bit) noexcept
+{
+    static_assert(Core::bitband, "The core has no bit-band regions, use read-modify-write");
+    auto const& region = addr >= peripheral_bitband.begin ? peripheral_bitband : sram_bitband;
+    return region.alias + (addr - region.begin) * 32 + bit * 4;
+}
+
+static_assert(bitband_alias<profile<family::cortex_m3>>(0x40004004, 3) == 0x4208008c);
+static_assert(bitband_alias<profile<family::cortex_m3>>(0x20000000, 31) == 0x2200007c);
+static_assert(bitband_addressable<profile<family::cortex_m3>>(0x400fffff));
+static_assert(!bitband_addressable<profile<family::cortex_m3>>(0x40100000));
+static_assert(!bitband_addressable<profile<family::cortex_m7>>(0x40004000));
+
+}    // namespace armpp::hal::core
@@ -0,0 +1,254 @@
+#pragma once
+
+#include <armpp/hal/core.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @namespace armpp::hal::cpu
+ * @brief Core instructions that have no C++ equivalent
+ *
+ * On the host all the functions compile to compiler barriers, so that code using them can be built
+ * and exercised outside the target.
+ */
+namespace armpp::hal::cpu {
+
+/**
+ * @brief Read PRIMASK register
+ * @return Non-zero if the interrupts are masked
+ */
+inline std::uint32_t
+get_primask() noexcept
+{
+#if defined(__arm__)
+    std::uint32_t result;
+    asm volatile("mrs %0, primask" : "=r"(result)::"memory");
+    return result;
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief Write PRIMASK register
+ * @param val Non-zero value masks all configurable priority interrupts
+ */
+inline void
+set_primask(std::uint32_t val) noexcept
+{
+#if defined(__arm__)
+    asm volatile("msr primask, %0" ::"r"(val) : "memory");
+#else
+    (void)val;
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+/**
+ * @brief Read BASEPRI register
+ * @return Priority level masked, 0 if masking by priority is off
+ */
+template <typename Core = core::current>
+inline std::uint32_t
+get_basepri() noexcept
+{
+    static_assert(Core::basepri,
+                  "BASEPRI is not implemented on ARMv6-M cores, use cpu::critical_section");
+#if defined(__arm__)
+    std::uint32_t result;
+    asm volatile("mrs %0, basepri" : "=r"(result)::"memory");
+    return result;
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief Write BASEPRI register
+ * @param val Interrupts with priority value equal or greater (less urgent) are masked, 0 unmasks
+ *            all of them. The value is in the priority register format, the implemented bits are
+ *            the most significant ones.
+ */
+template <typename Core = core::current>
+inline void
+set_basepri(std::uint32_t val) noexcept
+{
+    static_assert(Core::basepri,
+                  "BASEPRI is not implemented on ARMv6-M cores, use cpu::critical_section");
+#if defined(__arm__)
+    asm volatile("msr basepri, %0" ::"r"(val) : "memory");
+#else
+    (void)val;
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+/**
+ * @brief Mask all configurable priority interrupts (CPSID i)
+ */
+inline void
+disable_interrupts() noexcept
+{
+#if defined(__arm__)
+    asm volatile("cpsid i" ::: "memory");
+#else
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+/**
+ * @brief Unmask configurable priority interrupts (CPSIE i)
+ */
+inline void
+enable_interrupts() noexcept
+{
+#if defined(__arm__)
+    asm volatile("cpsie i" ::: "memory");
+#else
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+/**
+ * @brief Wait for interrupt
+ */
+inline void
+wait_for_interrupt() noexcept
+{
+#if defined(__arm__)
+    asm volatile("wfi" ::: "memory");
+#endif
+}
+
+/**
+ * @brief Wait for event
+ */
+inline void
+wait_for_event() noexcept
+{
+#if defined(__arm__)
+    asm volatile("wfe" ::: "memory");
+#endif
+}
+
+/**
+ * @brief Signal an event to wake a core waiting in WFE
+ */
+inline void
+send_event() noexcept
+{
+#if defined(__arm__)
+    asm volatile("sev" ::: "memory");
+#endif
+}
+
+/**
+ * @brief Queue wake policy signalling an event
+ *
+ * Wakes a consumer waiting in `wait_for_event`, see `util::spsc_queue` and `util::mpsc_queue`.
+ */
+struct event_notifier {
+    void
+    notify() const noexcept
+    {
+        send_event();
+    }
+};
+
+/**
+ * @brief Data synchronisation barrier
+ */
+inline void
+data_sync_barrier() noexcept
+{
+#if defined(__arm__)
+    asm volatile("dsb" ::: "memory");
+#else
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+#endif
+}
+
+/**
+ * @brief Instruction synchronisation barrier
+ */
+inline void
+instruction_sync_barrier() noexcept
+{
+#if defined(__arm__)
+    asm volatile("isb" ::: "memory");
+#else
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+/**
+ * @class critical_section
+ * @brief RAII guard masking interrupts for the lifetime of the object
+ *
+ * The previous PRIMASK value is restored on destruction, so the guards can be nested and used
+ * from interrupt handlers.
+ */
+class critical_section {
+public:
+    critical_section() noexcept : primask_{get_primask()} { disable_interrupts(); }
+    ~critical_section() noexcept { set_primask(primask_); }
+
+    critical_section(critical_section const&) = delete;
+    critical_section(critical_section&&)      = delete;
+
+    critical_section&
+    operator=(critical_section const&)
+        = delete;
+    critical_section&
+    operator=(critical_section&&)
+        = delete;
+
+private:
+    std::uint32_t primask_;
+};
+
+/**
+ * @class priority_mask
+ * @brief RAII guard masking the interrupts of a priority level and below
+ *
+ * Unlike `critical_section` the more urgent interrupts are still served while the guard is alive.
+ * The mask is only raised, a guard nested in a section with a stricter mask keeps it. Needs
+ * BASEPRI, on ARMv6-M cores the guard fails to compile.
+ *
+ * @tparam Priority Priority value in the priority register format, must not be 0
+ */
+template <std::uint32_t Priority, typename Core = core::current>
+class priority_mask {
+    static_assert(Core::basepri,
+                  "Masking by priority needs BASEPRI, ARMv6-M cores have only PRIMASK, use "
+                  "cpu::critical_section");
+    static_assert(Priority != 0 && Priority <= 0xff,
+                  "Priority must be in 1..255, BASEPRI 0 disables the masking");
+
+public:
+    priority_mask() noexcept : basepri_{get_basepri<Core>()}
+    {
+#if defined(__arm__)
+        asm volatile("msr basepri_max, %0" ::"r"(Priority) : "memory");
+#else
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+    }
+    ~priority_mask() noexcept { set_basepri<Core>(basepri_); }
+
+    priority_mask(priority_mask const&) = delete;
+    priority_mask(priority_mask&&)      = delete;
+
+    priority_mask&
+    operator=(priority_mask const&)
+        = delete;
+    priority_mask&
+    operator=(priority_mask&&)
+        = delete;
+
+private:
+    std::uint32_t basepri_;
+};
+
+}    // namespace armpp::hal::cpu
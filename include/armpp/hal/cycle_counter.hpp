@@ -0,0 +1,80 @@
+#pragma once
+
+#include <armpp/hal/core.hpp>
+#include <armpp/hal/dwt.hpp>
+#include <armpp/hal/system.hpp>
+#include <armpp/hal/systick.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+namespace armpp::hal {
+
+/**
+ * @brief Source of the core clock cycle count
+ */
+enum class cycle_source {
+    dwt,    /*!< DWT CYCCNT, ARMv7-M */
+    systick /*!< SysTick current value combined with the system tick count */
+};
+
+template <typename Core = core::current>
+constexpr cycle_source default_cycle_source
+    = Core::cycle_counter ? cycle_source::dwt : cycle_source::systick;
+
+/**
+ * @class cycle_counter
+ * @brief Free running 32 bit count of core clock cycles, for timing code sections
+ *
+ * With the DWT cycle counter reading the count is a single load. ARMv6-M cores have no DWT, the
+ * count is derived from the SysTick counter started by `system_init` and the millisecond tick
+ * count, it doesn't advance the milliseconds while the interrupts are masked.
+ *
+ * The count wraps around, only differences of two readings are meaningful.
+ */
+template <cycle_source Source = default_cycle_source<>>
+class cycle_counter {
+    static_assert(Source != cycle_source::dwt || core::current::cycle_counter,
+                  "The core has no DWT cycle counter, use cycle_source::systick");
+
+public:
+    static constexpr cycle_source source = Source;
+
+public:
+    cycle_counter() = delete;
+
+    /**
+     * @brief Start counting, the DWT counter is reset to zero
+     */
+    static void
+    start() noexcept
+    {
+        if constexpr (source == cycle_source::dwt) {
+            dwt::start_cycle_counter();
+        }
+    }
+
+    static std::uint32_t
+    now() noexcept
+    {
+        if constexpr (source == cycle_source::dwt) {
+            return dwt::dwt_handle{}->cycles();
+        } else {
+            systick::systick_handle systick;
+            auto const&             clock  = system::clock::instance();
+            auto const              period = systick->reload_value() + 1;
+            std::uint32_t           tick;
+            std::uint32_t           current;
+            // The tick is incremented when the counter reloads, read again if it did in between
+            do {
+                tick = clock.tick();
+                std::atomic_signal_fence(std::memory_order_seq_cst);
+                current = systick->current_value();
+                std::atomic_signal_fence(std::memory_order_seq_cst);
+            } while (tick != clock.tick());
+            return tick * period + (period - 1 - current);
+        }
+    }
+};
+
+}    // namespace armpp::hal
@@ -0,0 +1,236 @@
+#pragma once
+
+#include <armpp/hal/common_types.hpp>
+#include <armpp/hal/handle_base.hpp>
+#include <armpp/hal/registers.hpp>
+
+/**
+ * @namespace armpp::hal::dwt
+ * @brief Data Watchpoint and Trace unit profiling counters
+ *
+ * The counters are implemented on ARMv7-M cores only (Cortex-M3/M4/M7), the cycle counter may be
+ * missing even there, check `cycle_counter_supported`.
+ */
+namespace armpp::hal::dwt {
+
+/**
+ * @brief Debug Exception and Monitor Control Register
+ *
+ * Only the TRCENA bit is described, it gates the power to DWT and ITM units.
+ */
+union debug_exception_monitor_control_register {
+    /**
+     * Enable DWT and ITM units. The counters are not running and cannot be written when the bit is
+     * cleared.
+     */
+    bool_read_write_register_field<24> trcena;
+
+    raw_register volatile raw;
+};
+static_assert(sizeof(debug_exception_monitor_control_register) == sizeof(raw_register));
+
+/**
+ * @brief Core debug registers
+ *
+ * Only DEMCR is accessed, the rest of the registers belong to the debugger.
+ */
+class core_debug {
+public:
+    static constexpr address base_address = 0xe000edf0;
+    static constexpr address end_address  = 0xe000ee00;
+
+public:
+    core_debug()                  = delete;
+    core_debug(core_debug const&) = delete;
+    core_debug(core_debug&&)      = delete;
+
+    core_debug&
+    operator=(core_debug const&)
+        = delete;
+    core_debug&
+    operator=(core_debug&&)
+        = delete;
+
+    bool
+    trace_enabled() const
+    {
+        return demcr_.trcena;
+    }
+
+    void
+    trace_enable()
+    {
+        demcr_.trcena = true;
+    }
+
+private:
+    raw_register                             dhcsr_;    // 0xe000edf0
+    raw_register                             dcrsr_;    // 0xe000edf4
+    raw_register                             dcrdr_;    // 0xe000edf8
+    debug_exception_monitor_control_register demcr_;    // 0xe000edfc
+};
+
+static_assert(sizeof(core_debug) == core_debug::end_address - core_debug::base_address);
+
+/**
+ * @brief DWT Control Register
+ */
+union control_register {
+    bool_read_write_register_field<0>  cyccntena;   /*!< Enable the cycle counter */
+    bool_read_write_register_field<17> cpievtena;   /*!< Enable the CPI counter event */
+    bool_read_write_register_field<18> excevtena;   /*!< Enable the exception overhead event */
+    bool_read_write_register_field<19> sleepevtena; /*!< Enable the sleep counter event */
+    bool_read_write_register_field<20> lsuevtena;   /*!< Enable the LSU counter event */
+    bool_read_write_register_field<21> foldevtena;  /*!< Enable the folded instruction event */
+    /**
+     * The cycle counter is not implemented when the bit is set
+     */
+    bool_read_only_register_field<25> nocyccnt;
+    /**
+     * Number of comparators implemented
+     */
+    raw_read_only_register_field<28, 4> numcomp;
+
+    raw_register volatile raw;
+};
+static_assert(sizeof(control_register) == sizeof(raw_register));
+
+/**
+ * @brief Cycle Count Register, counts processor clock cycles, wraps around silently
+ */
+using cycle_count_register = raw_read_write_register_field<0, 32>;
+/**
+ * @brief 8 bit profiling counters (CPI, exception overhead, sleep, LSU, folded instructions)
+ */
+using event_count_register = raw_read_write_register_field<0, 8>;
+
+/**
+ * @brief Data Watchpoint and Trace unit
+ */
+class dwt {
+public:
+    static constexpr address base_address = 0xe0001000;
+    static constexpr address end_address  = 0xe0001020;
+
+public:
+    dwt()           = delete;
+    dwt(dwt const&) = delete;
+    dwt(dwt&&)      = delete;
+
+    dwt&
+    operator=(dwt const&)
+        = delete;
+    dwt&
+    operator=(dwt&&)
+        = delete;
+
+    bool
+    cycle_counter_supported() const
+    {
+        return !control_.nocyccnt;
+    }
+
+    bool
+    cycle_counter_enabled() const
+    {
+        return control_.cyccntena;
+    }
+
+    void
+    cycle_counter_enable()
+    {
+        control_.cyccntena = true;
+    }
+
+    void
+    cycle_counter_disable()
+    {
+        control_.cyccntena = false;
+    }
+
+    raw_register
+    cycles() const
+    {
+        return cyccnt_;
+    }
+
+    void
+    set_cycles(raw_register value)
+    {
+        cyccnt_ = value;
+    }
+
+    /**
+     * @brief Cycles spent on multi-cycle instructions, not counting the first cycle, modulo 256
+     */
+    raw_register
+    cpi_count() const
+    {
+        return cpicnt_;
+    }
+
+    /**
+     * @brief Cycles spent on exception entry and return, modulo 256
+     */
+    raw_register
+    exception_count() const
+    {
+        return exccnt_;
+    }
+
+    /**
+     * @brief Cycles spent sleeping, modulo 256
+     */
+    raw_register
+    sleep_count() const
+    {
+        return sleepcnt_;
+    }
+
+    /**
+     * @brief Additional cycles spent on load and store instructions, modulo 256
+     */
+    raw_register
+    lsu_count() const
+    {
+        return lsucnt_;
+    }
+
+    /**
+     * @brief Number of folded (zero cycle) instructions, modulo 256
+     */
+    raw_register
+    fold_count() const
+    {
+        return foldcnt_;
+    }
+
+private:
+    control_register     control_;     // 0xe0001000
+    cycle_count_register cyccnt_;      // 0xe0001004
+    event_count_register cpicnt_;      // 0xe0001008
+    event_count_register exccnt_;      // 0xe000100c
+    event_count_register sleepcnt_;    // 0xe0001010
+    event_count_register lsucnt_;      // 0xe0001014
+    event_count_register foldcnt_;     // 0xe0001018
+    raw_register         pcsr_;        // 0xe000101c
+};
+
+static_assert(sizeof(dwt) == dwt::end_address - dwt::base_address);
+
+using core_debug_handle = static_handle<core_debug>;
+using dwt_handle        = static_handle<dwt>;
+
+/**
+ * @brief Enable the trace block and start the cycle counter from zero
+ */
+inline void
+start_cycle_counter()
+{
+    core_debug_handle{}->trace_enable();
+    dwt_handle dwt;
+    dwt->set_cycles(0);
+    dwt->cycle_counter_enable();
+}
+
+}    // namespace armpp::hal::dwt
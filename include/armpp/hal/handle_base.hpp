@@ -2,6 +2,10 @@
 
 #include <armpp/hal/registers.hpp>
 
+#if defined(ARMPP_SIMULATED_PERIPHERALS)
+#    include <armpp/hal/simulator.hpp>
+#endif
+
 namespace armpp::concepts {
 
 template <typename Device>
@@ -11,19 +15,36 @@ concept unique_device = requires(Device const&) { Device::base_address; };
 
 namespace armpp::hal {
 
+/**
+ * @brief Device at a peripheral address
+ *
+ * Maps the address to the simulated peripheral memory in host builds with
+ * `ARMPP_SIMULATED_PERIPHERALS` defined, see `armpp::hal::sim`.
+ */
+template <typename Device>
+Device&
+device_at(address device_address) noexcept
+{
+#if defined(ARMPP_SIMULATED_PERIPHERALS)
+    return *static_cast<Device*>(sim::memory(device_address, sizeof(Device)));
+#else
+    return *reinterpret_cast<Device*>(device_address);
+#endif
+}
+
 template <typename Device>
 struct handle_base {
     using device_type = Device;
 
     handle_base()
         requires concepts::unique_device<device_type>
-        : device_{*reinterpret_cast<device_type*>(device_type::base_address)}
+        : device_{device_at<device_type>(device_type::base_address)}
     {}
 
     handle_base(device_type& device) noexcept : device_{device} {}
 
     handle_base(address device_address) noexcept
-        : device_{*reinterpret_cast<device_type*>(device_address)}
+        : device_{device_at<device_type>(device_address)}
     {}
 
     device_type&
@@ -54,4 +75,58 @@ protected:
     device_type& device_;
 };
 
+/**
+ * @class static_handle
+ * @brief Handle to a device at an address known at compile time
+ *
+ * Unlike `handle_base`, which holds a reference to the device, the handle is an empty type. The
+ * device address is a template parameter, so `operator->` folds to a constant, the compiler loads
+ * the address from the literal pool once per function and uses immediate offsets for the register
+ * accesses. The handle costs nothing to construct, store or pass around.
+ *
+ * ```c++
+ * using timer0 = static_handle<timer::timer, 0x40000000>;
+ * timer0{}->start();
+ * ```
+ *
+ * @tparam Device  Device type
+ * @tparam Address Device base address, defaults to `Device::base_address` for unique devices
+ */
+template <typename Device, address Address = Device::base_address>
+struct static_handle {
+    using device_type = Device;
+
+    static constexpr address device_address = Address;
+
+    constexpr static_handle() noexcept = default;
+
+    /**
+     * @brief Construct the handle and configure the device
+     * @param init Device initialization parameters, passed to `Device::configure`
+     */
+    template <typename Init>
+    explicit static_handle(Init const& init) noexcept
+    {
+        device().configure(init);
+    }
+
+    static device_type&
+    device() noexcept
+    {
+        return device_at<device_type>(device_address);
+    }
+
+    device_type&
+    operator*() const noexcept
+    {
+        return device();
+    }
+
+    device_type*
+    operator->() const noexcept
+    {
+        return &device();
+    }
+};
+
 }    // namespace armpp::hal
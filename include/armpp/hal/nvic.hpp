@@ -1,6 +1,7 @@
 #pragma once
 
 #include <armpp/hal/common_types.hpp>
+#include <armpp/hal/core.hpp>
 #include <armpp/hal/handle_base.hpp>
 #include <armpp/hal/registers.hpp>
 
@@ -12,6 +13,15 @@ namespace armpp::hal::nvic {
 constexpr std::uint32_t interrupt_reg_count = 8;
 constexpr std::uint32_t interrupt_count     = 240;    // 240 as per ARM docs
 
+/**
+ * @brief Number of external interrupts the current core can implement, 32 on ARMv6-M
+ *
+ * The register layout always covers 240 interrupts, the registers of the missing ones read as
+ * zero and ignore writes.
+ */
+constexpr std::uint32_t core_interrupt_count = core::current::max_irq_count;
+static_assert(core_interrupt_count <= interrupt_count);
+
 union interrupt_set_enable_register {
     read_only_register_field_array<enabled_t, 1, interrupt_count, interrupt_reg_count> get;
     write_only_register_field_array<set_t, 1, interrupt_count, interrupt_reg_count>    set;
@@ -125,6 +135,29 @@ public:
         icer_.set[index] = clear_t::clear;
     }
 
+    /**
+     * @brief Enable IRQ known at compile time, checked against the interrupts of the core
+     */
+    template <irqn_t Irqn>
+    void
+    enable_irq()
+    {
+        static_assert(Irqn >= irqn_t::base, "Only external interrupts can be enabled in NVIC");
+        static_assert(static_cast<std::uint32_t>(Irqn) < core_interrupt_count,
+                      "The IRQ number exceeds the interrupts the core implements");
+        enable_irq(Irqn);
+    }
+
+    template <irqn_t Irqn>
+    void
+    disable_irq()
+    {
+        static_assert(Irqn >= irqn_t::base, "Only external interrupts can be disabled in NVIC");
+        static_assert(static_cast<std::uint32_t>(Irqn) < core_interrupt_count,
+                      "The IRQ number exceeds the interrupts the core implements");
+        disable_irq(Irqn);
+    }
+
     bool
     irq_enabled(irqn_t irqn) const
     {
@@ -177,7 +210,7 @@ static_assert(sizeof(nvic)
                      * (8 + 24 + 8 + 24 + 8 + 24 + 8 + 24 + 8 + 56 + 60 + 644 + 1));
 static_assert(sizeof(nvic) == (0xe000ef04 - nvic::base_address));    // Full NVIC size
 
-class nvic_handle : public handle_base<nvic> {};
+using nvic_handle = static_handle<nvic>;
 
 // software trigger interrupt                   0xe000ef00
 
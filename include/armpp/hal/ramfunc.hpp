@@ -0,0 +1,32 @@
+#pragma once
+
+/**
+ * @def ARMPP_RAMFUNC
+ * @brief Place a function to RAM
+ *
+ * Code executed from flash stalls for the flash wait states on every fetch that misses the
+ * prefetch buffer, code executed from SRAM is fetched with zero wait states. The attribute is meant
+ * for interrupt handlers and the few functions they call.
+ *
+ * The functions go to the `.ramfunc` section. `add_firmware` generates the output section
+ * description, the firmware linker script includes it after `.data` with
+ * `INCLUDE armpp_ramfunc.ld`. `reset_handler` copies the section from flash to RAM together with
+ * `.data`. The functions are never inlined, so the code doesn't leak back to flash. Calls between
+ * flash and RAM are out of the `BL` instruction range, the linker inserts long branch veneers for
+ * them.
+ *
+ * Outside the target the macro expands to nothing.
+ *
+ * ```c++
+ * extern "C" ARMPP_RAMFUNC void
+ * timer0_handler()
+ * {
+ *     // ...
+ * }
+ * ```
+ */
+#if defined(__arm__) && !defined(ARMPP_NO_RAMFUNC)
+#    define ARMPP_RAMFUNC __attribute__((section(".ramfunc"), noinline, long_call))
+#else
+#    define ARMPP_RAMFUNC
+#endif
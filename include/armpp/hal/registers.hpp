@@ -1,6 +1,7 @@
 #pragma once
 
 #include <armpp/hal/common_types.hpp>
+#include <armpp/hal/core.hpp>
 #include <armpp/util/concepts.hpp>
 #include <armpp/util/flags.hpp>
 #include <armpp/util/mask.hpp>
@@ -104,8 +105,24 @@ enum class register_mode { volatile_reg = 0, non_volatile_reg = 1 };
  *      str     r3, [sp, #4]
  * ```
  * The code was compiled with -O3 flag
+ *
+ * Both modes read the register before writing a field. Three more modes avoid the read where the
+ * register semantics allow it:
+ *
+ * - `store_only` writes the field value shifted in place and zeros to the rest of the register,
+ *   a single store. Only for registers where writing zero has no effect: write-one-to-clear and
+ *   write-one-to-set bits, write-only registers. A read-modify-write of such a register writes
+ *   back the ones read and clears or sets the bits of the other fields as well.
+ * - `byte_lane` accesses a byte or a halfword field aligned to its size with a STRB/STRH, the
+ *   other fields of the register are not touched. The peripheral must decode the byte strobes,
+ *   the Cortex-M system control space does, many APB peripherals don't.
+ * - `bitband` writes a one bit field with a single store to the bit-band alias of the register
+ *   when the core has bit-band regions and the register is in one, falls back to the bitwise
+ *   logic otherwise.
+ *
+ * The modes are picked from the SVD access attributes by `tools/svd_codegen.py`.
  */
-enum class access_mode { field = 0, bitwise_logic };
+enum class access_mode { field = 0, bitwise_logic, store_only, byte_lane, bitband };
 
 template <typename T>
 struct default_access_mode;
@@ -366,6 +383,184 @@ struct register_data<T, Offset, Size, access_mode::bitwise_logic, Mode, SetValue
     constexpr register_data() = default;
 };
 
+/**
+ * @brief Value of a field shifted in place and masked
+ */
+template <std::size_t Offset, std::size_t Size, concepts::register_value T>
+constexpr raw_register
+field_bits(T value)
+{
+    constexpr auto mask = util::bit_mask_v<Offset, Size, raw_register>;
+    if constexpr (concepts::flags<T>) {
+        return (value.underlying() << Offset) & mask;
+    } else {
+        return (static_cast<raw_register>(value) << Offset) & mask;
+    }
+}
+
+/**
+ * @brief Field value from the bits of a register or of a byte lane
+ */
+template <concepts::register_value T, std::size_t Offset, std::size_t Size>
+constexpr T
+field_value(raw_register bits)
+{
+    constexpr auto mask = util::bit_mask_v<Offset, Size, raw_register>;
+    if constexpr (concepts::flags<T>) {
+        return T{static_cast<typename T::enumeration_type>((bits & mask) >> Offset)};
+    } else {
+        return static_cast<T>((bits & mask) >> Offset);
+    }
+}
+
+/**
+ * @brief Specialization of register_data for store only access mode
+ *
+ * Reads as the bitwise logic mode, a write is a single store of the field value, the other fields
+ * of the register are written with zeros.
+ */
+template <concepts::register_value T, std::size_t Offset, std::size_t Size, register_mode Mode,
+          concepts::register_value SetValueType>
+struct register_data<T, Offset, Size, access_mode::store_only, Mode, SetValueType>
+    : register_data<T, Offset, Size, access_mode::bitwise_logic, Mode, SetValueType> {
+    using base_type      = register_data<T, Offset, Size, access_mode::bitwise_logic, Mode,
+                                         SetValueType>;
+    using set_value_type = SetValueType;
+
+    using base_type::get;
+
+    /**
+     * @brief Set the value of the field, zero the rest of the register
+     * @param value The value to be set
+     */
+    void
+    set(set_value_type value)
+    {
+        this->register_ = field_bits<Offset, Size>(value);
+    }
+
+    /**
+     * @brief Set the value of the field, zero the rest of the register
+     * @param value The value to be set
+     */
+    void
+    set(set_value_type value) volatile
+    {
+        this->register_ = field_bits<Offset, Size>(value);
+    }
+
+    constexpr register_data() = default;
+};
+
+/**
+ * @brief Specialization of register_data for byte lane access mode
+ *
+ * The register is accessed as an array of bytes or halfwords, the field is one element of it.
+ * Cortex-M cores are little-endian, the lane index is the offset divided by the size.
+ */
+template <concepts::register_value T, std::size_t Offset, std::size_t Size, register_mode Mode,
+          concepts::register_value SetValueType>
+struct register_data<T, Offset, Size, access_mode::byte_lane, Mode, SetValueType> {
+    static_assert((Size == 8 || Size == 16) && Offset % Size == 0,
+                  "A byte lane field is a byte or a halfword aligned to its size");
+
+    using value_type     = T;
+    using set_value_type = SetValueType;
+    using lane_type      = std::conditional_t<Size == 8, std::uint8_t, std::uint16_t>;
+    using storage_type   = field_storage_type_t<lane_type, Mode>;
+
+    static constexpr std::size_t lane = Offset / Size;
+
+    storage_type lanes_[register_bits / Size];
+
+    /**
+     * @brief Get the value of the field
+     * @return The value of the field
+     */
+    constexpr value_type
+    get() const
+    {
+        return field_value<value_type, 0, Size>(lanes_[lane]);
+    }
+
+    value_type
+    get() volatile const
+    {
+        return field_value<value_type, 0, Size>(lanes_[lane]);
+    }
+
+    /**
+     * @brief Set the value of the field with a byte or a halfword store
+     * @param value The value to be set
+     */
+    void
+    set(set_value_type value)
+    {
+        lanes_[lane] = static_cast<lane_type>(field_bits<0, Size>(value));
+    }
+
+    /**
+     * @brief Set the value of the field with a byte or a halfword store
+     * @param value The value to be set
+     */
+    void
+    set(set_value_type value) volatile
+    {
+        lanes_[lane] = static_cast<lane_type>(field_bits<0, Size>(value));
+    }
+
+    constexpr register_data() = default;
+};
+
+/**
+ * @brief Specialization of register_data for bit-band access mode
+ *
+ * Reads as the bitwise logic mode. A write to a register in a bit-band region is a single store to
+ * the alias word of the bit, elsewhere and on cores without bit-banding it is a read-modify-write.
+ */
+template <concepts::register_value T, std::size_t Offset, std::size_t Size, register_mode Mode,
+          concepts::register_value SetValueType>
+struct register_data<T, Offset, Size, access_mode::bitband, Mode, SetValueType>
+    : register_data<T, Offset, Size, access_mode::bitwise_logic, Mode, SetValueType> {
+    static_assert(Size == 1, "Only one bit fields can be accessed through the bit-band alias");
+
+    using base_type      = register_data<T, Offset, Size, access_mode::bitwise_logic, Mode,
+                                         SetValueType>;
+    using set_value_type = SetValueType;
+
+    using base_type::get;
+
+    /**
+     * @brief Set the value of the field
+     * @param value The value to be set
+     */
+    void
+    set(set_value_type value)
+    {
+        base_type::set(value);
+    }
+
+    /**
+     * @brief Set the value of the field through the bit-band alias when possible
+     * @param value The value to be set
+     */
+    void
+    set(set_value_type value) volatile
+    {
+        if constexpr (core::on_target && core::current::bitband) {
+            auto addr = static_cast<address>(reinterpret_cast<std::uintptr_t>(&this->register_));
+            if (core::bitband_addressable(addr)) {
+                *reinterpret_cast<raw_register volatile*>(core::bitband_alias(addr, Offset))
+                    = field_bits<0, 1>(value);
+                return;
+            }
+        }
+        base_type::set(value);
+    }
+
+    constexpr register_data() = default;
+};
+
 }    // namespace detail
 
 /**
@@ -771,15 +966,16 @@ using bit_write_only_register_field
 /**
  * @typedef bit_read_clear_register_field
  *
- * Register to read register bit field, write `clear_t::clear` to clear
+ * Register to read register bit field, write `clear_t::clear` to clear. The bits are write one to
+ * clear, writing zeros to the other bits of the register has no effect.
  *
  * @tparam Offset Offset of the register.
  * @tparam AccessType Type to read from the register
- * @tparam Access Access mode of the register (default: access_mode::bitwise_logic).
+ * @tparam Access Access mode of the register (default: access_mode::store_only).
  * @tparam Mode Mode of the register (default: register_mode::volatile_reg).
  */
 template <std::size_t   Offset, typename AccessType = raw_register,
-          access_mode   Access = access_mode::bitwise_logic,
+          access_mode   Access = access_mode::store_only,
           register_mode Mode   = register_mode::volatile_reg>
 using bit_read_clear_register_field
     = read_write_register_field<AccessType, Offset, 1, Access, Mode, clear_t>;
@@ -857,6 +1053,16 @@ static_assert(!is_register_field<std::uint32_t>::value);
 static_assert(is_register_field<bool_read_write_register_field<0>>::value);
 static_assert(is_register_field<bool_read_only_register_field<0>>::value);
 static_assert(is_register_field<bool_write_only_register_field<0>>::value);
+static_assert(sizeof(read_write_register_field<raw_register, 8, 8, access_mode::byte_lane>)
+              == sizeof(raw_register));
+static_assert(sizeof(read_write_register_field<raw_register, 16, 16, access_mode::byte_lane>)
+              == sizeof(raw_register));
+static_assert(sizeof(bit_read_write_register_field<5, access_mode::store_only>)
+              == sizeof(raw_register));
+static_assert(sizeof(bit_read_write_register_field<5, access_mode::bitband>)
+              == sizeof(raw_register));
+static_assert(detail::field_bits<4, 3>(raw_register{0xf}) == 0x70);
+static_assert(detail::field_value<raw_register, 4, 3>(0xff) == 0x7);
 
 /**
  * @brief Concept for register fields.
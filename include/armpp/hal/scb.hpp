@@ -3,6 +3,7 @@
 #include <armpp/hal/common_types.hpp>
 #include <armpp/hal/handle_base.hpp>
 #include <armpp/hal/registers.hpp>
+#include <armpp/hal/snapshot.hpp>
 
 namespace armpp::hal::scb {
 
@@ -28,6 +29,9 @@ static_assert(sizeof(cpu_id_base_register) == sizeof(raw_register));
  * - check for pending exceptions
  * - check the vector number of the highest priority pended exception
  * - check the vector number of the active exception.
+ *
+ * Writing zero to any bit has no effect, the set and clear fields are stored without reading the
+ * register first.
  */
 union interrupt_control_state_register {
     /**
@@ -69,28 +73,28 @@ union interrupt_control_state_register {
      * 1 = clear pending SysTick
      * 0 = do not clear pending SysTick.
      */
-    write_only_register_field<clear_t, 25, 1> pendstclr;
+    write_only_register_field<clear_t, 25, 1, access_mode::store_only> pendstclr;
     /**
      * Set a pending SysTick bit
      *
      * 1 = set pending SysTick
      * 0 = do not set pending SysTick.
      */
-    read_write_register_field<set_t, 26, 1> pendstset;
+    read_write_register_field<set_t, 26, 1, access_mode::store_only> pendstset;
     /**
      * Clear pending pendSV bit:
      *
      * 1 = clear pending pendSV
      * 0 = do not clear pending pendSV.
      */
-    write_only_register_field<clear_t, 25, 1> pendsvclr;
+    write_only_register_field<clear_t, 27, 1, access_mode::store_only> pendsvclr;
     /**
      * Set a pending pendSV bit
      *
      * 1 = set pending pendSV
      * 0 = do not set pending pendSV.
      */
-    read_write_register_field<set_t, 26, 1> pendsvset;
+    read_write_register_field<set_t, 28, 1, access_mode::store_only> pendsvset;
     /**
      * Set pending NMI bit:
      *
@@ -100,7 +104,7 @@ union interrupt_control_state_register {
      * NMIPENDSET pends and activates an NMI. Because NMI is the highest-priority interrupt, it
      * takes effect as soon as it registers.
      */
-    read_write_register_field<set_t, 26, 1> nmipendset;
+    read_write_register_field<set_t, 31, 1, access_mode::store_only> nmipendset;
 };
 static_assert(sizeof(interrupt_control_state_register) == sizeof(raw_register));
 
@@ -180,7 +184,7 @@ union app_interrupt_and_reset_control_register {
      * ENDIANESS is sampled from the BIGEND input port during reset. You cannot change ENDIANESS
      * outside of reset.
      */
-    read_only_register_field<endiannes_t, 2, 1, access_mode::bitwise_logic, Mode> edniannes;
+    read_only_register_field<endiannes_t, 15, 1, access_mode::bitwise_logic, Mode> edniannes;
 
     raw_read_only_register_field<16, 16, access_mode::bitwise_logic, Mode>  vectkeystat;
     raw_read_write_register_field<16, 16, access_mode::bitwise_logic, Mode> vectkey;
@@ -491,7 +495,7 @@ union configurable_fault_status_register {
      * instruction is used with a divisor of 0, this fault occurs The instruction is executed and
      * the return PC points to it. If DIV_0_TRP is not set, then the divide returns a quotient of 0.
      */
-    bit_read_clear_register_field<15> dibyzero;
+    bit_read_clear_register_field<25> dibyzero;
     //@}
 };
 static_assert(sizeof(configurable_fault_status_register) == sizeof(raw_register));
@@ -637,6 +641,8 @@ public:
     static constexpr address base_address = 0xe000ed00;
     static constexpr address end_address  = 0xe000ed3c + sizeof(auxilary_fault_address_register);
 
+    class snapshot;
+
     cpu_id
     get_cpu_id() const
     {
@@ -692,6 +698,24 @@ public:
         aircr_.raw = new_val.raw;
     }
 
+    /**
+     * @brief Set PendSV exception pending
+     */
+    void
+    set_pend_sv()
+    {
+        icsr_.pendsvset = set_t::set;
+    }
+
+    /**
+     * @brief Check if PendSV exception is pending
+     */
+    bool
+    pend_sv_pending() const
+    {
+        return icsr_.pendsvset == set_t::set;
+    }
+
     [[noreturn]] void
     system_reset()
     {
@@ -724,11 +748,50 @@ private:
 
 static_assert(sizeof(scb) == scb::end_address - scb::base_address);
 
-class scb_handle : public handle_base<scb> {
+/**
+ * @class scb::snapshot
+ * @brief Copy of the SCB configuration registers
+ *
+ * VTOR, SCR, CCR and the system handler priorities. AIRCR needs a key on every write and SHCSR
+ * holds the handler active bits that change under the copy, they are modified directly.
+ */
+class scb::snapshot
+    : public register_snapshot<scb, &scb::voff_, &scb::scr_, &scb::ccr_, &scb::shp_> {
 public:
-    using base_type = handle_base<scb>;
+    using base_type = register_snapshot<scb, &scb::voff_, &scb::scr_, &scb::ccr_, &scb::shp_>;
+    using base_type::base_type;
 
-    scb_handle() : base_type{scb::base_address} {}
+    vector_table_offset_register&
+    vector_table_offset() noexcept
+    {
+        return get<0>();
+    }
+
+    system_control_register&
+    system_control() noexcept
+    {
+        return get<1>();
+    }
+
+    configuration_control_register&
+    configuration_control() noexcept
+    {
+        return get<2>();
+    }
+
+    std::uint32_t
+    get_priority(system_handler_index_t syshandler) const noexcept
+    {
+        return get<3>()[static_cast<std::uint32_t>(syshandler)];
+    }
+
+    void
+    set_priority(system_handler_index_t syshandler, std::uint32_t priority) noexcept
+    {
+        get<3>()[static_cast<std::uint32_t>(syshandler)] = priority;
+    }
 };
 
+using scb_handle = static_handle<scb>;
+
 }    // namespace armpp::hal::scb
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <armpp/hal/common_types.hpp>
+
+#include <cstddef>
+
+/**
+ * @namespace armpp::hal::sim
+ * @brief Simulated peripheral backend for host builds
+ *
+ * With `ARMPP_SIMULATED_PERIPHERALS` defined, device handles don't dereference the peripheral
+ * addresses, the addresses are mapped to zero-initialized host memory pages instead. The
+ * registers behave as plain memory: there are no side effects, the status bits keep the values
+ * last written. Code waiting for a hardware event (`uart::get`, `timer::delay`) spins forever
+ * unless the status bits are set beforehand.
+ *
+ * The backend is meant for host benchmarks and unit checks of the register logic, it is not an
+ * emulator.
+ */
+namespace armpp::hal::sim {
+
+/**
+ * @brief Size of a simulated peripheral page, a device must not cross a page boundary
+ */
+constexpr std::size_t page_size = 0x1000;
+/**
+ * @brief Maximum number of distinct pages
+ */
+constexpr std::size_t page_count = 16;
+
+/**
+ * @brief Host memory backing a peripheral address
+ *
+ * The page is allocated on first access from a static pool, the function doesn't use the heap.
+ *
+ * @param device_address Peripheral address
+ * @param size           Size of the device, the device must fit in the page
+ * @return Pointer to the host memory
+ */
+void*
+memory(address device_address, std::size_t size) noexcept;
+
+/**
+ * @brief Zero the memory of all simulated pages
+ */
+void
+reset() noexcept;
+
+}    // namespace armpp::hal::sim
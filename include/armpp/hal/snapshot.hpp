@@ -0,0 +1,245 @@
+#pragma once
+
+#include <armpp/hal/common_types.hpp>
+#include <armpp/hal/registers.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace armpp::hal {
+
+/**
+ * @brief Non-volatile counterpart of a register type
+ *
+ * Register fields and registers templated on `register_mode` are mapped to their
+ * `register_mode::non_volatile_reg` versions, other types are left as is.
+ */
+template <typename T>
+struct non_volatile_register {
+    using type = T;
+};
+
+template <template <typename, std::size_t, std::size_t, access_mode, register_mode, typename>
+          typename Reg,
+          concepts::register_value T, std::size_t Offset, std::size_t Size, access_mode Access,
+          register_mode Mode, concepts::register_value SetValueType>
+struct non_volatile_register<Reg<T, Offset, Size, Access, Mode, SetValueType>> {
+    using type = Reg<T, Offset, Size, Access, register_mode::non_volatile_reg, SetValueType>;
+};
+
+template <template <register_mode> typename Reg, register_mode Mode>
+struct non_volatile_register<Reg<Mode>> {
+    using type = Reg<register_mode::non_volatile_reg>;
+};
+
+template <typename T>
+using non_volatile_register_t = typename non_volatile_register<T>::type;
+
+/**
+ * @class register_snapshot
+ * @brief Non-volatile copy of a set of device registers
+ *
+ * The registers are read once on construction, the fields are changed in the copy without bus
+ * access, `commit` writes back only the words that differ from the values read, in the order the
+ * registers are listed. Reconfiguring a running peripheral costs exactly as many bus writes as
+ * there are changed registers.
+ *
+ * Only registers without read or write side effects should be listed, the data registers and the
+ * write-one-to-clear interrupt registers are left out.
+ *
+ * @tparam Device    Device type
+ * @tparam Registers Pointers to the device register members, in commit order
+ */
+template <typename Device, auto... Registers>
+class register_snapshot {
+public:
+    using device_type = Device;
+
+    static constexpr std::size_t register_count = sizeof...(Registers);
+
+    template <std::size_t I>
+    using register_type = std::remove_cvref_t<
+        decltype(std::declval<device_type&>().*std::get<I>(std::tuple{Registers...}))>;
+
+    template <std::size_t I>
+    using view_type = non_volatile_register_t<register_type<I>>;
+
+public:
+    /**
+     * @brief Read the registers of the device
+     */
+    explicit register_snapshot(device_type& device) noexcept : device_{device} { read(); }
+
+    register_snapshot(register_snapshot const&) = delete;
+    register_snapshot(register_snapshot&&)      = delete;
+
+    register_snapshot&
+    operator=(register_snapshot const&)
+        = delete;
+    register_snapshot&
+    operator=(register_snapshot&&)
+        = delete;
+
+    /**
+     * @brief Re-read the registers, the changes that were not committed are lost
+     */
+    void
+    read() noexcept
+    {
+        [this]<std::size_t... I>(std::index_sequence<I...>) {
+            (read_register<I>(), ...);
+        }(std::make_index_sequence<register_count>{});
+    }
+
+    /**
+     * @brief Write the changed registers back to the device
+     * @return Number of bus writes performed
+     */
+    std::size_t
+    commit() noexcept
+    {
+        std::size_t writes = 0;
+        // Comma fold keeps the registers in order
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            ((writes += commit_register<I>()), ...);
+        }(std::make_index_sequence<register_count>{});
+        return writes;
+    }
+
+    /**
+     * @brief Drop the changes that were not committed
+     */
+    void
+    discard() noexcept
+    {
+        std::memcpy(values_, original_.data(), sizeof(values_));
+    }
+
+    /**
+     * @brief Check if any register was changed since it was read or committed
+     */
+    bool
+    dirty() const noexcept
+    {
+        return std::memcmp(values_, original_.data(), sizeof(values_)) != 0;
+    }
+
+protected:
+    /**
+     * @brief Access the copy of a register
+     * @tparam I Index of the register in the `Registers` list
+     */
+    template <std::size_t I>
+    view_type<I>&
+    get() noexcept
+    {
+        return *reinterpret_cast<view_type<I>*>(values_ + byte_offset<I>);
+    }
+
+    template <std::size_t I>
+    view_type<I> const&
+    get() const noexcept
+    {
+        return *reinterpret_cast<view_type<I> const*>(values_ + byte_offset<I>);
+    }
+
+    device_type&
+    device() noexcept
+    {
+        return device_;
+    }
+
+private:
+    template <std::size_t... I>
+    static constexpr std::array<std::size_t, register_count>
+    register_sizes(std::index_sequence<I...>)
+    {
+        return {(sizeof(register_type<I>) / sizeof(raw_register))...};
+    }
+
+    template <std::size_t... I>
+    static constexpr bool
+    registers_are_words(std::index_sequence<I...>)
+    {
+        return ((sizeof(register_type<I>) % sizeof(raw_register) == 0) && ...);
+    }
+
+    static_assert(registers_are_words(std::make_index_sequence<register_count>{}),
+                  "Register size must be a multiple of a word");
+
+    static constexpr auto word_sizes = register_sizes(std::make_index_sequence<register_count>{});
+
+    static constexpr std::size_t word_count = [] {
+        std::size_t count = 0;
+        for (auto size : word_sizes) {
+            count += size;
+        }
+        return count;
+    }();
+
+    static constexpr auto word_offsets = [] {
+        std::array<std::size_t, register_count> offsets{};
+        std::size_t                             offset = 0;
+        for (std::size_t i = 0; i < register_count; ++i) {
+            offsets[i] = offset;
+            offset += word_sizes[i];
+        }
+        return offsets;
+    }();
+
+    template <std::size_t I>
+    static constexpr std::size_t byte_offset = word_offsets[I] * sizeof(raw_register);
+
+    template <std::size_t I>
+    raw_register volatile*
+    register_address() noexcept
+    {
+        constexpr auto member = std::get<I>(std::tuple{Registers...});
+        return reinterpret_cast<raw_register volatile*>(&(device_.*member));
+    }
+
+    template <std::size_t I>
+    void
+    read_register() noexcept
+    {
+        auto regs = register_address<I>();
+        for (std::size_t w = 0; w < word_sizes[I]; ++w) {
+            auto index       = word_offsets[I] + w;
+            original_[index] = regs[w];
+            std::memcpy(values_ + index * sizeof(raw_register), &original_[index],
+                        sizeof(raw_register));
+        }
+    }
+
+    template <std::size_t I>
+    std::size_t
+    commit_register() noexcept
+    {
+        auto        regs   = register_address<I>();
+        std::size_t writes = 0;
+        for (std::size_t w = 0; w < word_sizes[I]; ++w) {
+            auto         index = word_offsets[I] + w;
+            raw_register value;
+            std::memcpy(&value, values_ + index * sizeof(raw_register), sizeof(raw_register));
+            if (value != original_[index]) {
+                regs[w]          = value;
+                original_[index] = value;
+                ++writes;
+            }
+        }
+        return writes;
+    }
+
+private:
+    device_type& device_;
+    // The copy is accessed through the register types, the words are accessed with memcpy only,
+    // so the compiler sees both as accesses to the same bytes
+    alignas(raw_register) std::byte values_[word_count * sizeof(raw_register)]{};
+    std::array<raw_register, word_count> original_{};
+};
+
+}    // namespace armpp::hal
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Reset handler, the first vector table entry after the initial stack pointer
+ *
+ * - starts the DWT cycle counter (ARMv7-M)
+ * - copies `.data` and `.ramfunc` (see `ARMPP_RAMFUNC`) from flash and zeroes `.bss`, four words
+ *   per `ldm`/`stm` instruction
+ * - calls `system_init`, so the clock is set up before the static constructors run
+ * - runs `.preinit_array` and `.init_array`
+ * - calls `armpp_boot_complete` with the number of cycles spent since reset
+ * - calls `main`
+ *
+ * The linker script must define word aligned `_sidata` (load address of `.data`), `_sdata`,
+ * `_edata`, `_sbss` and `_ebss`, and keep the `__preinit_array_start`/`__preinit_array_end`,
+ * `__init_array_start`/`__init_array_end` symbols of the standard GNU linker scripts.
+ */
+extern "C" [[noreturn]] void
+reset_handler();
+
+/**
+ * @brief Boot time measurement hook
+ *
+ * Called right before `main`. The default implementation does nothing, define the function in the
+ * application to log or store the value.
+ *
+ * @param cycles Core clock cycles from reset, 0 if the core has no cycle counter
+ */
+extern "C" void
+armpp_boot_complete(std::uint32_t cycles);
+
+namespace armpp::hal::startup {
+
+/**
+ * @brief Core clock cycles spent from reset to `main`
+ */
+std::uint32_t
+boot_cycles() noexcept;
+
+}    // namespace armpp::hal::startup
@@ -25,10 +25,13 @@ public:
     clock(clock const&) = delete;
     clock(clock&&)      = delete;
 
+    /**
+     * @brief Advance the tick, called from the SysTick handler only, the single writer
+     */
     void
     increment_tick()
     {
-        ++tick_;
+        tick_ = tick_ + 1;
     }
 
     tick_type
@@ -50,23 +53,32 @@ public:
     }
 
 public:
+    /**
+     * @brief The system clock, constant initialized, the access needs no guard check
+     */
     static clock const&
-    instance();
+    instance()
+    {
+        return instance_;
+    }
 
     static time_point
     now()
     {
-        return time_point{duration{instance().tick_}};
+        return time_point{duration{instance_.tick_}};
     }
 
 private:
     friend void ::system_init();
     friend void ::system_tick();
 
-    clock() = default;
+    constexpr clock() noexcept = default;
 
     static clock&
-    mutable_instance();
+    mutable_instance()
+    {
+        return instance_;
+    }
 
     template <typename Period>
     void
@@ -75,8 +87,12 @@ private:
         system_frequency_ = freq;
     }
 
-    frequency_type system_frequency_;
-    tick_type      tick_;
+    frequency_type system_frequency_{};
+    // Written by the SysTick handler, every read is a load from memory, so a wait loop on
+    // `now()` sees the tick advance
+    tick_type volatile tick_ = 0;
+
+    static clock instance_;
 };
 
 }    // namespace armpp::hal::system
@@ -2,6 +2,7 @@
 
 #include <armpp/hal/handle_base.hpp>
 #include <armpp/hal/registers.hpp>
+#include <armpp/hal/snapshot.hpp>
 
 namespace armpp::hal::systick {
 
@@ -84,6 +85,8 @@ class systick {
 public:
     static constexpr address base_address = 0xe000e010;
 
+    class snapshot;
+
 public:
     systick()               = delete;
     systick(systick const&) = delete;
@@ -218,13 +221,43 @@ private:
 static_assert(sizeof(systick) == sizeof(raw_register) * 4);
 
 /**
- * @brief Handle class for SysTick.
+ * @class systick::snapshot
+ * @brief Copy of the SysTick reload and control registers
+ *
+ * Reading the control register clears the COUNTFLAG bit.
  */
-class systick_handle : public handle_base<systick> {
+class systick::snapshot
+    : public register_snapshot<systick, &systick::reload_value_, &systick::control_status_> {
 public:
-    using base_type = handle_base<systick>;
+    using base_type
+        = register_snapshot<systick, &systick::reload_value_, &systick::control_status_>;
+    using base_type::base_type;
+
+    /**
+     * @brief Control and status register copy
+     */
+    control_status_register&
+    control() noexcept
+    {
+        return get<1>();
+    }
 
-    systick_handle() : base_type{systick::base_address} {}
+    raw_register
+    reload_value() const noexcept
+    {
+        return get<0>();
+    }
+
+    void
+    set_reload_value(raw_register value) noexcept
+    {
+        get<0>() = value;
+    }
 };
 
+/**
+ * @brief Handle class for SysTick.
+ */
+using systick_handle = static_handle<systick>;
+
 }    // namespace armpp::hal::systick
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <armpp/hal/handle_base.hpp>
 #include <armpp/hal/registers.hpp>
+#include <armpp/hal/snapshot.hpp>
 
 namespace armpp::hal::timer {
 
@@ -70,6 +72,9 @@ struct timer_init {
  * @brief Class representing a timer device.
  */
 class timer {
+public:
+    class snapshot;
+
 public:
     timer()             = delete;
     timer(timer const&) = delete;
@@ -187,8 +192,33 @@ public:
         reload_ = val;
     }
 
+    /**
+     * @brief Delays the execution for the specified number of timer ticks.
+     * @param ticks The number of timer ticks to delay for.
+     */
+    void
+    delay(std::uint32_t ticks)
+    {
+        stop();
+        reset();
+        enable_inrerrupt();
+
+        set_reload(ticks);
+        start();
+
+        while (!get_interrupt())
+            ;
+
+        stop();
+        disable_iterrupt();
+        clear_interrupt();
+        reset();
+    }
+
 private:
     friend class timer_handle;
+    template <typename, address>
+    friend struct hal::static_handle;
 
     /**
      * @brief Configures the timer with the given initialization parameters.
@@ -204,21 +234,69 @@ private:
     interrupt_register interrupt_; /*<! Interrupt status/clear register */
 };
 
+/**
+ * @class timer::snapshot
+ * @brief Copy of the timer configuration registers
+ *
+ * The reload and value registers are committed before the control register, so a timer enabled in
+ * the same commit starts with the new values.
+ *
+ * ```c++
+ * timer::snapshot snap{*timer0};
+ * snap.set_reload(ticks_per_milli * 10);
+ * snap.commit();    // one bus write, the control register is untouched
+ * ```
+ */
+class timer::snapshot
+    : public register_snapshot<timer, &timer::reload_, &timer::value_, &timer::ctrl_> {
+public:
+    using base_type = register_snapshot<timer, &timer::reload_, &timer::value_, &timer::ctrl_>;
+    using base_type::base_type;
+
+    /**
+     * @brief Control register copy
+     */
+    control_register&
+    control() noexcept
+    {
+        return get<2>();
+    }
+
+    raw_register
+    reload() const noexcept
+    {
+        return get<0>();
+    }
+
+    void
+    set_reload(raw_register value) noexcept
+    {
+        get<0>() = value;
+    }
+
+    raw_register
+    value() const noexcept
+    {
+        return get<1>();
+    }
+
+    void
+    set_value(raw_register value) noexcept
+    {
+        get<1>() = value;
+    }
+};
+
 static_assert(sizeof(timer) == sizeof(raw_register) * 4);
 
 /**
  * @class timer_handle
  * @brief Class representing a handle to a timer.
  */
-class timer_handle {
+class timer_handle : public handle_base<timer> {
 public:
-    /**
-     * @brief Constructor for timer_handle.
-     * @param device_address The address of the timer device.
-     */
-    timer_handle(address device_address) noexcept
-        : device_{*reinterpret_cast<timer*>(device_address)}
-    {}
+    using base_type = handle_base<timer>;
+    using base_type::base_type;
 
     /**
      * @brief Constructor for timer_handle.
@@ -242,46 +320,6 @@ public:
         device_.configure(init);
     }
 
-    /**
-     * @brief Dereference operator
-     * @return The Timer device reference
-     */
-    timer&
-    operator*() noexcept
-    {
-        return device_;
-    }
-
-    /**
-     * @brief Const dereference operator
-     * @return The Timer device const reference
-     */
-    timer const&
-    operator*() const noexcept
-    {
-        return device_;
-    }
-
-    /**
-     * @brief Arrow operator
-     * @return The pointer to the Timer device
-     */
-    timer*
-    operator->() noexcept
-    {
-        return &device_;
-    }
-
-    /**
-     * @brief Const arrow operator
-     * @return The const pointer to the Timer device
-     */
-    timer const*
-    operator->() const noexcept
-    {
-        return &device_;
-    }
-
     /**
      * @brief Delays the execution for the specified number of timer ticks.
      * @param ticks The number of timer ticks to delay for.
@@ -289,24 +327,8 @@ public:
     void
     delay(std::uint32_t ticks)
     {
-        device_.stop();
-        device_.reset();
-        device_.enable_inrerrupt();
-
-        device_.set_reload(ticks);
-        device_.start();
-
-        while (!device_.get_interrupt())
-            ;
-
-        device_.stop();
-        device_.disable_iterrupt();
-        device_.clear_interrupt();
-        device_.reset();
+        device_.delay(ticks);
     }
-
-private:
-    timer& device_; /*<! Reference to the Timer device. */
 };
 
 }    // namespace armpp::hal::timer
@@ -1,11 +1,13 @@
 #pragma once
 
 #include <armpp/hal/handle_base.hpp>
+#include <armpp/hal/ramfunc.hpp>
 #include <armpp/hal/registers.hpp>
+#include <armpp/hal/snapshot.hpp>
+#include <armpp/util/callback.hpp>
 #include <armpp/util/to_chars.hpp>
 
 #include <cstdint>
-#include <functional>
 
 /**
  * @namespace armpp::hal::uart
@@ -28,8 +30,10 @@ static_assert(sizeof(data_register) == 4);
 union state_register {
     bool_read_only_register_field<0> tx_buffer_full;
     bool_read_only_register_field<1> rx_buffer_full;
-    bit_read_write_register_field<2> tx_buffer_overrun;
-    bit_read_write_register_field<3> rx_buffer_overrun;
+    /** Write one to clear */
+    bit_read_write_register_field<2, access_mode::store_only> tx_buffer_overrun;
+    /** Write one to clear */
+    bit_read_write_register_field<3, access_mode::store_only> rx_buffer_overrun;
 
     raw_register volatile raw;
 };
@@ -59,6 +63,9 @@ static_assert(sizeof(control_register<>) == 4);
 /**
  * @typedef interrupt_register
  * @brief Union for accessing and resetting interrupt register fields
+ *
+ * The bits are write one to clear, the clear fields are stored without reading the register, a
+ * read-modify-write would clear the other pending interrupts as well.
  */
 union interrupt_register {
     bool_read_only_register_field<0> tx_interrupt;
@@ -66,10 +73,10 @@ union interrupt_register {
     bool_read_only_register_field<2> tx_overrun_interrupt;
     bool_read_only_register_field<3> rx_overrun_interrupt;
 
-    write_only_register_field<clear_t, 0, 1> tx_interrupt_clear;
-    write_only_register_field<clear_t, 0, 1> rx_interrupt_clear;
-    write_only_register_field<clear_t, 0, 1> tx_overrun_interrupt_clear;
-    write_only_register_field<clear_t, 0, 1> rx_overrun_interrupt_clear;
+    write_only_register_field<clear_t, 0, 1, access_mode::store_only> tx_interrupt_clear;
+    write_only_register_field<clear_t, 1, 1, access_mode::store_only> rx_interrupt_clear;
+    write_only_register_field<clear_t, 2, 1, access_mode::store_only> tx_overrun_interrupt_clear;
+    write_only_register_field<clear_t, 3, 1, access_mode::store_only> rx_overrun_interrupt_clear;
 
     raw_register volatile raw;
 };
@@ -125,9 +132,11 @@ class uart_handle;
  */
 class uart {
 public:
-    using rx_callback_type  = std::function<void(uart_handle&, char)>;
-    using tx_callback_type  = std::function<void(uart_handle&)>;
-    using ovr_callback_type = std::function<void(uart_handle&)>;
+    using rx_callback_type  = util::callback<void(uart_handle&, char)>;
+    using tx_callback_type  = util::callback<void(uart_handle&)>;
+    using ovr_callback_type = util::callback<void(uart_handle&)>;
+
+    class snapshot;
 
 public:
     uart()            = delete;
@@ -271,10 +280,8 @@ public:
     void
     write(Integer val, number_base base, std::int8_t width, char fill = ' ')
     {
-        constexpr auto byte_count = sizeof(Integer);
-        constexpr auto bit_count  = byte_count * 8;
-        char           buffer[bit_count + 1];
-        util::to_chars(buffer, bit_count + 1, val, base, width, fill);
+        char buffer[util::to_chars_buffer_size<Integer>];
+        util::to_chars(buffer, sizeof(buffer), val, base, width, fill);
         write(buffer);
     }
 
@@ -290,11 +297,42 @@ public:
         return static_cast<char>(data_.get());
     }
 
+    /**
+     * @brief Service every pending RX and TX interrupt with a handler set
+     *
+     * The interrupt status is read once and the serviced sources are cleared with a single store,
+     * RX is handled before TX. A source without a handler is left pending.
+     */
     void
     process_interrupt();
+    /**
+     * @brief Service both overrun flags, if set, and clear them with a single store
+     */
     void
     process_overrun_interrupt();
 
+    /**
+     * @brief Interrupt handler of the UART at an address
+     *
+     * Bound to the IRQ lines of the instance by the board descriptor, see `board::peripheral`.
+     */
+    template <address Address>
+    ARMPP_RAMFUNC static void
+    interrupt_handler()
+    {
+        static_handle<uart, Address>{}->process_interrupt();
+    }
+
+    /**
+     * @brief Handler of an overrun interrupt line shared by several UARTs
+     */
+    template <address... Addresses>
+    ARMPP_RAMFUNC static void
+    overrun_interrupt_handler()
+    {
+        (static_handle<uart, Addresses>{}->process_overrun_interrupt(), ...);
+    }
+
     void
     set_tx_handler(tx_callback_type&& cb);
 
@@ -308,6 +346,8 @@ public:
 
 private:
     friend class uart_handle;
+    template <typename, address>
+    friend struct hal::static_handle;
 
     /**
      * @brief Configure the UART
@@ -326,6 +366,58 @@ private:
 
 static_assert(sizeof(uart) == 4 * 5);
 
+/**
+ * @class uart::snapshot
+ * @brief Copy of the UART configuration registers
+ *
+ * The baud rate divider is committed before the control register, so the new rate is in effect
+ * when the transmitter or the receiver is enabled.
+ *
+ * ```c++
+ * uart::snapshot snap{*uart0};
+ * snap.set_baud_rate(115200);
+ * snap.commit();    // one bus write
+ * ```
+ */
+class uart::snapshot : public register_snapshot<uart, &uart::bauddiv_, &uart::ctrl_> {
+public:
+    using base_type = register_snapshot<uart, &uart::bauddiv_, &uart::ctrl_>;
+    using base_type::base_type;
+
+    /**
+     * @brief Control register copy
+     */
+    control_register<register_mode::non_volatile_reg>&
+    control() noexcept
+    {
+        return get<1>();
+    }
+
+    raw_register
+    baud_divider() const noexcept
+    {
+        return get<0>();
+    }
+
+    void
+    set_baud_divider(raw_register value) noexcept
+    {
+        get<0>() = value;
+    }
+
+    /**
+     * @brief Set the baud rate divider for the system clock frequency
+     */
+    void
+    set_baud_rate(std::uint32_t baud_rate) noexcept;
+
+    /**
+     * @brief Apply the initialization parameters to the copy
+     */
+    void
+    apply(uart_init const& init) noexcept;
+};
+
 //----------------------------------------------------------------------------
 /**
  * @class uart_handle
@@ -358,6 +450,23 @@ public:
         device_.configure(init);
     }
 
+    /**
+     * @brief Change the configuration of a running UART
+     *
+     * Unlike `configure`, the buffers and the interrupt state are not reset, and only the
+     * registers that change are written.
+     *
+     * @param init The initialization parameters
+     * @return Number of registers written
+     */
+    std::size_t
+    reconfigure(uart_init const& init) noexcept
+    {
+        uart::snapshot snap{device_};
+        snap.apply(init);
+        return snap.commit();
+    }
+
     /**
      * @brief Set the output number base
      * @param val The output number base to set
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <armpp/hal/uart_io.hpp>
+#include <armpp/util/lzss.hpp>
+#include <armpp/util/to_chars.hpp>
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+
+namespace armpp::hal::uart {
+
+/**
+ * @class compressed_uart
+ * @brief UART output through a streaming LZSS compressor
+ *
+ * Takes the same `operator<<` output as a `uart_handle`, the integers are formatted with the
+ * number base and width of the handle. The compressed bytes are collected in records of up to
+ * `record_size` and written to a `uart_log`, the TX interrupt sends them, so a writer does not
+ * wait for the UART. The stream cannot lose bytes: if the log is full, the writer drains it and
+ * waits for the space, which happens only when the link cannot keep up with the compressed
+ * output. Write from thread mode, the log must carry only the compressed stream.
+ *
+ * The compressed stream is decoded on the host with `tools/lzss_decode.py`. The output reaches the
+ * host in whole tokens, `flush` writes what is held back, e.g. at the end of a report or before
+ * the core goes to sleep:
+ *
+ * ```c++
+ * hal::uart::uart_log<512>  log{uart0};
+ * hal::uart::compressed_uart telemetry{log};
+ * telemetry << "adc " << value << "\r\n";
+ * telemetry.flush();
+ * ```
+ *
+ * Text logs compress about 3 to 4 times with the default 256 byte window, the encoder takes
+ * 1.5 KiB of RAM.
+ *
+ * @tparam Log `uart_log` instance
+ * @tparam Encoder `util::lzss_encoder` instance
+ */
+template <typename Log, typename Encoder = util::lzss_encoder<>>
+class compressed_uart {
+public:
+    using log_type     = Log;
+    using encoder_type = Encoder;
+
+    /** Largest record written to the log */
+    static constexpr std::size_t record_size
+        = std::min<std::size_t>(32, log_type::buffer_type::max_record_size);
+
+public:
+    explicit compressed_uart(log_type& log) noexcept : log_{log} {}
+
+    compressed_uart(compressed_uart const&) = delete;
+    compressed_uart(compressed_uart&&)      = delete;
+
+    compressed_uart&
+    operator=(compressed_uart const&)
+        = delete;
+    compressed_uart&
+    operator=(compressed_uart&&)
+        = delete;
+
+    void
+    put(char c)
+    {
+        encoder_.put(c, output());
+    }
+
+    void
+    write(std::string_view str)
+    {
+        encoder_.write(str, output());
+    }
+
+    /**
+     * @brief Write the input held by the encoder and the collected bytes to the log
+     */
+    void
+    flush()
+    {
+        encoder_.flush(output());
+        submit();
+    }
+
+    uart_handle&
+    handle() noexcept
+    {
+        return log_.handle();
+    }
+
+    encoder_type const&
+    encoder() const noexcept
+    {
+        return encoder_;
+    }
+
+private:
+    auto
+    output() noexcept
+    {
+        return [this](char c) {
+            record_[size_++] = c;
+            if (size_ == record_size)
+                submit();
+        };
+    }
+
+    void
+    submit() noexcept
+    {
+        if (size_ == 0)
+            return;
+        std::string_view data{record_.data(), size_};
+        // Check the space first, a failed write would count as a dropped record
+        while (!(log_.fits(size_) && log_.write(data))) {
+            log_.drain();
+        }
+        size_ = 0;
+    }
+
+private:
+    log_type&                     log_;
+    encoder_type                  encoder_;
+    std::array<char, record_size> record_{};
+    std::size_t                   size_ = 0;
+};
+
+template <typename Log, typename Encoder>
+compressed_uart<Log, Encoder>&
+operator<<(compressed_uart<Log, Encoder>& dev, char c)
+{
+    dev.put(c);
+    return dev;
+}
+
+template <typename Log, typename Encoder>
+compressed_uart<Log, Encoder>&
+operator<<(compressed_uart<Log, Encoder>& dev, std::string_view str)
+{
+    dev.write(str);
+    return dev;
+}
+
+template <typename Log, typename Encoder>
+compressed_uart<Log, Encoder>&
+operator<<(compressed_uart<Log, Encoder>& dev, char const* str)
+{
+    dev.write(str);
+    return dev;
+}
+
+template <typename Log, typename Encoder, std::integral T>
+compressed_uart<Log, Encoder>&
+operator<<(compressed_uart<Log, Encoder>& dev, T val)
+{
+    char buffer[util::to_chars_buffer_size<T>];
+    util::to_chars(buffer, sizeof(buffer), val, dev.handle().get_output_number_base(),
+                   dev.handle().get_output_width());
+    dev.write(buffer);
+    return dev;
+}
+
+template <typename Log, typename Encoder, concepts::enumeration E>
+compressed_uart<Log, Encoder>&
+operator<<(compressed_uart<Log, Encoder>& dev, E val)
+{
+    return dev << static_cast<std::underlying_type_t<E>>(val);
+}
+
+}    // namespace armpp::hal::uart
@@ -2,7 +2,9 @@
 
 #include <armpp/frequency.hpp>
 #include <armpp/hal/uart.hpp>
+#include <armpp/util/flags.hpp>
 
+#include <limits>
 #include <string_view>
 
 namespace armpp::hal::uart {
@@ -81,24 +83,21 @@ template <concepts::flags F>
 uart_handle&
 operator<<(uart_handle& dev, F val)
 {
-    using enumeration_type   = typename F::enumeration_type;
-    constexpr auto bit_count = F::bits;
-    if (!val) {
-        dev << "{}";
-    } else {
-        auto cnt = 0;
-        dev->put('{');
-        for (auto i = bit_count; i > 0; --i) {
-            auto f = static_cast<enumeration_type>(1 << (i - 1));
-            if (!!(val & f)) {
-                if (cnt > 0) {
-                    dev->put(',');
-                }
-                dev << f;
-            }
+    using enumeration_type = typename F::enumeration_type;
+    using unsigned_type    = decltype(util::flag_bits(val));
+    constexpr auto top_bit = std::numeric_limits<unsigned_type>::digits - 1;
+    dev->put('{');
+    // Highest flag first, one step per set flag
+    for (auto bits = util::flag_bits(val); bits != 0;) {
+        auto top = top_bit - util::countl_zero(bits);
+        auto f   = static_cast<unsigned_type>(unsigned_type{1} << top);
+        bits     = static_cast<unsigned_type>(bits & ~f);
+        dev << static_cast<enumeration_type>(f);
+        if (bits != 0) {
+            dev->put(',');
         }
-        dev->put('}');
     }
+    dev->put('}');
     return dev;
 }
 
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <armpp/hal/uart.hpp>
+#include <armpp/util/atomic.hpp>
+#include <armpp/util/log_buffer.hpp>
+
+#include <cstddef>
+#include <string_view>
+#include <utility>
+
+namespace armpp::hal::uart {
+
+/**
+ * @class uart_log
+ * @brief Log output over a UART, safe to write from any handler and from thread mode
+ *
+ * The records are kept in a `util::log_buffer` and fed to the UART from the TX interrupt, the
+ * object installs the TX handler of the device, the UART must be configured with the TX interrupt
+ * enabled. A writer never waits: if the buffer is full the record is dropped and counted, if
+ * another context is feeding the UART the writer leaves the record to it. The TX handler is
+ * replaced, the UART cannot be shared with a `coro::async_uart`.
+ *
+ * ```c++
+ * hal::uart::uart_log<1024> log{uart0};
+ * log.write("boot\r\n");
+ * if (auto record = log.reserve(32)) {
+ *     auto size = record.write(0, "fault: ");
+ *     record.commit(size + record.write(size, fault_name));
+ * }
+ * ```
+ *
+ * @tparam Capacity Buffer size in bytes, power of two
+ */
+template <std::size_t Capacity>
+class uart_log {
+public:
+    using buffer_type = util::log_buffer<Capacity>;
+
+    /**
+     * @brief Reserved record, committed and sent when destroyed
+     */
+    class record : public util::log_record {
+    public:
+        record(record&& rhs) noexcept
+            : util::log_record{std::move(rhs)}, log_{std::exchange(rhs.log_, nullptr)}
+        {}
+
+        ~record()
+        {
+            util::log_record::commit();
+            if (log_)
+                log_->drain();
+        }
+
+        void
+        commit(std::size_t size) noexcept
+        {
+            util::log_record::commit(size);
+        }
+
+    private:
+        friend class uart_log;
+
+        record(util::log_record&& rec, uart_log* log) noexcept
+            : util::log_record{std::move(rec)}, log_{log}
+        {}
+
+        uart_log* log_;
+    };
+
+public:
+    explicit uart_log(uart_handle& handle) noexcept : handle_{handle}
+    {
+        handle_->set_tx_handler([this](uart_handle&) { drain(); });
+    }
+
+    uart_log(uart_log const&) = delete;
+    uart_log(uart_log&&)      = delete;
+
+    uart_log&
+    operator=(uart_log const&)
+        = delete;
+    uart_log&
+    operator=(uart_log&&)
+        = delete;
+
+    /**
+     * @brief Reserve space for a record
+     * @return Empty record if the buffer is full
+     */
+    record
+    reserve(std::size_t size) noexcept
+    {
+        return record{buffer_.reserve(size), this};
+    }
+
+    /**
+     * @brief Log a string as one record
+     * @return false if the record was dropped
+     */
+    bool
+    write(std::string_view str) noexcept
+    {
+        auto written = buffer_.write(str);
+        drain();
+        return written;
+    }
+
+    /**
+     * @brief Feed the committed records to the UART until its TX buffer is full
+     *
+     * Called from the TX interrupt and after a commit. Only one context feeds the UART at a time,
+     * the others return at once, the feeding one checks for new records before it leaves.
+     */
+    void
+    drain() noexcept
+    {
+        while (true) {
+            std::uint32_t idle = 0;
+            if (!draining_.compare_exchange(idle, 1))
+                return;
+            for (auto data = buffer_.read_span(); !data.empty(); data = buffer_.read_span()) {
+                std::size_t sent = 0;
+                while (sent < data.size() && !handle_->tx_buffer_full()) {
+                    handle_->put(data[sent++]);
+                }
+                buffer_.consume(sent);
+                if (sent < data.size())
+                    break;
+            }
+            draining_.store(0);
+            if (!buffer_.readable() || handle_->tx_buffer_full())
+                return;
+        }
+    }
+
+    /**
+     * @brief A record of `size` characters fits in the buffer now
+     */
+    bool
+    fits(std::size_t size) const noexcept
+    {
+        return buffer_.fits(size);
+    }
+
+    uart_handle&
+    handle() noexcept
+    {
+        return handle_;
+    }
+
+    /**
+     * @brief Number of records dropped because the buffer was full
+     */
+    std::uint32_t
+    dropped() const noexcept
+    {
+        return buffer_.dropped();
+    }
+
+private:
+    uart_handle&        handle_;
+    buffer_type         buffer_;
+    util::atomic_word<> draining_;
+};
+
+}    // namespace armpp::hal::uart
@@ -0,0 +1,169 @@
+#pragma once
+
+#include <armpp/hal/system.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+#ifndef ARMPP_KERNEL_TIME_SLICE
+#    define ARMPP_KERNEL_TIME_SLICE 10    // system clock ticks
+#endif
+
+extern "C" void
+pendsv_handler();
+
+extern "C" void
+armpp_kernel_tick();
+
+/**
+ * @namespace armpp::kernel
+ * @brief Minimal fixed-priority preemptive kernel
+ *
+ * Tasks run in thread mode on the process stack (PSP), interrupts and the kernel itself use the
+ * main stack. Context is switched in the PendSV exception which runs at the lowest priority, so a
+ * switch requested from an ISR happens when all the nested interrupts have returned.
+ *
+ * The ready tasks are kept in a FIFO per priority level, the levels that have ready tasks are
+ * marked in a 32 bit bitmap. The highest ready priority is found with a single CLZ instruction, so
+ * scheduling doesn't depend on the number of tasks. Tasks of equal priority are round-robined every
+ * `ARMPP_KERNEL_TIME_SLICE` system clock ticks.
+ *
+ * Vector table must point PendSV to `pendsv_handler` and SysTick to `system_tick`.
+ *
+ * ```c++
+ * armpp::kernel::thread<256> blinker;
+ *
+ * void blink(void*) {
+ *     while (true) {
+ *         toggle_led();
+ *         armpp::kernel::sleep_for(500_ms);
+ *     }
+ * }
+ *
+ * int main() {
+ *     blinker.start(blink, nullptr, 1);
+ *     armpp::kernel::start();
+ * }
+ * ```
+ */
+namespace armpp::kernel {
+
+using priority_type   = std::uint8_t;
+using task_entry_type = void (*)(void*);
+using tick_type       = hal::system::clock::tick_type;
+
+/**
+ * Number of priority levels, 0 is the lowest priority and is used by the idle task.
+ */
+constexpr std::size_t priority_levels = 32;
+constexpr std::size_t time_slice      = ARMPP_KERNEL_TIME_SLICE;
+
+enum class task_state : std::uint8_t { dormant, ready, sleeping, finished };
+
+/**
+ * @brief Task control block
+ *
+ * The saved stack pointer must be the first member, context switch code relies on it.
+ */
+struct task_control_block {
+    std::uint32_t*      stack_pointer = nullptr;
+    task_control_block* next          = nullptr;
+    tick_type           wake_tick     = 0;
+    priority_type       priority      = 0;
+    task_state          state         = task_state::dormant;
+};
+
+/**
+ * @brief Prepare a task to run
+ *
+ * Builds the initial exception frame on the task stack and puts the task to the ready queue. Can
+ * be called both before and after `start`.
+ *
+ * @param tcb         Task control block
+ * @param stack       Stack memory, must be 8-byte aligned
+ * @param stack_words Stack size in words
+ * @param entry       Task function, when it returns the task is finished
+ * @param arg         Argument passed to the task function
+ * @param priority    Task priority, 1 to priority_levels - 1
+ */
+void
+create(task_control_block& tcb, std::uint32_t* stack, std::size_t stack_words,
+       task_entry_type entry, void* arg, priority_type priority);
+
+/**
+ * @brief Start scheduling
+ *
+ * Configures PendSV to the lowest priority, makes sure SysTick interrupt is enabled and switches to
+ * the highest priority task. When no task is ready the kernel idle task waits for an interrupt. The
+ * main stack is left to the interrupt handlers.
+ */
+[[noreturn]] void
+start();
+
+/**
+ * @brief Give the CPU to the next task of the same priority
+ */
+void
+yield();
+
+/**
+ * @brief Put the current task to sleep
+ * @param ticks Number of system clock ticks
+ */
+void
+sleep(tick_type ticks);
+
+template <typename Rep, typename Period>
+void
+sleep_for(std::chrono::duration<Rep, Period> const& dur)
+{
+    using clock = hal::system::clock;
+    sleep(static_cast<tick_type>(std::chrono::duration_cast<clock::duration>(dur).count()));
+}
+
+/**
+ * @brief Currently running task, nullptr before the kernel is started
+ */
+task_control_block*
+current() noexcept;
+
+/**
+ * @brief Number of context switches performed
+ */
+std::uint32_t
+switch_count() noexcept;
+
+/**
+ * @class thread
+ * @brief Statically allocated task with its stack
+ * @tparam StackWords Stack size in 32 bit words, must include 16 words for the saved context
+ */
+template <std::size_t StackWords>
+class thread : public task_control_block {
+public:
+    static_assert(StackWords >= 32, "Stack is too small for the saved context");
+    static constexpr std::size_t stack_words = StackWords;
+
+    constexpr thread() noexcept = default;
+
+    thread(thread const&) = delete;
+    thread(thread&&)      = delete;
+
+    thread&
+    operator=(thread const&)
+        = delete;
+    thread&
+    operator=(thread&&)
+        = delete;
+
+    void
+    start(task_entry_type entry, void* arg, priority_type priority)
+    {
+        create(*this, stack_, stack_words, entry, arg, priority);
+    }
+
+private:
+    alignas(8) std::uint32_t stack_[stack_words]{};
+};
+
+}    // namespace armpp::kernel
@@ -0,0 +1,258 @@
+#pragma once
+
+#include <armpp/hal/system.hpp>
+#include <armpp/hal/uart_io.hpp>
+#include <armpp/util/atomic.hpp>
+
+#include <cstdint>
+#include <string_view>
+
+#ifndef ARMPP_LOG_LEVEL
+#    define ARMPP_LOG_LEVEL info
+#endif
+
+#ifndef ARMPP_LOG_RATE_INTERVAL
+#    define ARMPP_LOG_RATE_INTERVAL 100    // milliseconds
+#endif
+
+#ifndef ARMPP_LOG_RATE_BURST
+#    define ARMPP_LOG_RATE_BURST 10
+#endif
+
+/**
+ * @namespace armpp::log
+ * @brief Leveled, rate limited log messages
+ *
+ * A message is written with a macro, the arguments go to the sink with `operator<<`:
+ *
+ * ```c++
+ * ARMPP_LOG(warning, uart0, "overcurrent on channel ", channel);
+ * ```
+ *
+ * The levels below `ARMPP_LOG_LEVEL` are removed at compile time, the statement is discarded
+ * with `if constexpr`, the arguments are not evaluated and the strings don't reach the binary.
+ *
+ * Each enabled statement is a site with a token bucket of its own, `ARMPP_LOG_RATE_BURST`
+ * messages at once and one more every `ARMPP_LOG_RATE_INTERVAL` milliseconds of the system
+ * clock. The messages over the rate are dropped before their arguments are evaluated and
+ * counted, the next message of the site that passes reports how many were dropped. A fault
+ * handler logging on every interrupt costs a compare-and-swap per interrupt instead of a UART
+ * line.
+ */
+namespace armpp::log {
+
+enum class level : std::uint8_t {
+    trace,
+    debug,
+    info,
+    warning,
+    error,
+    off,    /**< No messages, as the `ARMPP_LOG_LEVEL` value */
+};
+
+/** The lowest level compiled in */
+constexpr level compiled_level = level::ARMPP_LOG_LEVEL;
+
+constexpr bool
+enabled(level lvl) noexcept
+{
+    return lvl != level::off && lvl >= compiled_level;
+}
+
+constexpr std::string_view
+prefix(level lvl) noexcept
+{
+    switch (lvl) {
+    case level::trace:
+        return "T: ";
+    case level::debug:
+        return "D: ";
+    case level::info:
+        return "I: ";
+    case level::warning:
+        return "W: ";
+    case level::error:
+        return "E: ";
+    case level::off:
+        break;
+    }
+    return {};
+}
+
+/**
+ * @brief Message rate of a site
+ */
+struct rate {
+    std::uint32_t interval = 0; /**< Milliseconds per message, 0 is no limit */
+    std::uint32_t burst    = 1; /**< Messages passed at once after a quiet period */
+};
+
+constexpr rate default_rate{ARMPP_LOG_RATE_INTERVAL, ARMPP_LOG_RATE_BURST};
+
+/**
+ * @brief Messages dropped by all the sites
+ */
+inline constinit util::atomic_word<> suppressed_total;
+
+/**
+ * @brief Result of a rate check, converts to true if the message passes
+ */
+struct admission {
+    bool          pass       = false;
+    std::uint32_t suppressed = 0; /**< Messages of the site dropped since the last one passed */
+
+    constexpr explicit
+    operator bool() const noexcept
+    {
+        return pass;
+    }
+};
+
+/**
+ * @class site
+ * @brief Rate limiter of one log statement
+ *
+ * The token bucket is kept as the time the bucket is full again (GCRA), one word updated with a
+ * compare-and-swap, so a site is safe to reach from handlers of different priorities. The object
+ * is constant initialized, as a function local static it needs no guard.
+ *
+ * @tparam Rate Message rate
+ */
+template <rate Rate>
+class site {
+public:
+    static_assert(Rate.burst > 0, "A site must pass at least one message");
+
+    constexpr site() noexcept = default;
+
+    site(site const&) = delete;
+    site(site&&)      = delete;
+
+    site&
+    operator=(site const&)
+        = delete;
+    site&
+    operator=(site&&)
+        = delete;
+
+    admission
+    admit() noexcept
+    {
+        if constexpr (Rate.interval == 0) {
+            return {true, 0};
+        } else {
+            if (!take_token(hal::system::clock::instance().tick()))
+                return drop();
+            return {true, exchange_suppressed()};
+        }
+    }
+
+    /**
+     * @brief Messages dropped since the last one passed
+     */
+    std::uint32_t
+    suppressed() const noexcept
+    {
+        return suppressed_.load();
+    }
+
+private:
+    static constexpr std::uint32_t tolerance = Rate.interval * (Rate.burst - 1);
+
+    bool
+    take_token(std::uint32_t now) noexcept
+    {
+        auto full = full_at_.load();
+        while (true) {
+            // The wrapping distance to the time the bucket is full again, more than a bucket
+            // ahead is a time stamp from before a long quiet period
+            auto ahead = full - now;
+            if (ahead > tolerance + Rate.interval)
+                ahead = 0;
+            if (ahead > tolerance)
+                return false;
+            if (full_at_.compare_exchange(full, now + ahead + Rate.interval))
+                return true;
+        }
+    }
+
+    admission
+    drop() noexcept
+    {
+        suppressed_.fetch_add(1);
+        suppressed_total.fetch_add(1);
+        return {};
+    }
+
+    std::uint32_t
+    exchange_suppressed() noexcept
+    {
+        auto count = suppressed_.load();
+        while (count != 0 && !suppressed_.compare_exchange(count, 0)) {}
+        return count;
+    }
+
+private:
+    util::atomic_word<> full_at_;
+    util::atomic_word<> suppressed_;
+};
+
+/**
+ * @brief Write a message line, the prefix of the level, the arguments and the count of the
+ *        messages the site dropped before it
+ */
+template <typename Sink, typename... Args>
+void
+write(Sink& sink, level lvl, admission adm, Args const&... args)
+{
+    sink << prefix(lvl);
+    (sink << ... << args);
+    if (adm.suppressed != 0) {
+        sink << " (" << adm.suppressed << " suppressed)";
+    }
+    sink << "\r\n";
+}
+
+template <typename... Args>
+void
+write(hal::uart::uart_handle& sink, level lvl, admission adm, Args const&... args)
+{
+    // Counts are decimal whatever the output base of the handle
+    auto base  = sink.get_output_number_base();
+    auto width = sink.get_output_width();
+    sink << prefix(lvl);
+    (sink << ... << args);
+    if (adm.suppressed != 0) {
+        sink.set_output_number_base(hal::uart::number_base::dec);
+        sink.set_output_width(0);
+        sink << " (" << adm.suppressed << " suppressed)";
+        sink.set_output_number_base(base);
+        sink.set_output_width(width);
+    }
+    sink << "\r\n";
+}
+
+}    // namespace armpp::log
+
+/**
+ * @brief Log a message with a rate of the site
+ * @param LEVEL Level name, `trace`, `debug`, `info`, `warning` or `error`
+ * @param RATE `armpp::log::rate` constant
+ * @param SINK UART handle or another object with `operator<<` for the arguments
+ */
+#define ARMPP_LOG_RATE(LEVEL, RATE, SINK, ...)                                                  \
+    do {                                                                                        \
+        if constexpr (::armpp::log::enabled(::armpp::log::level::LEVEL)) {                      \
+            static constinit ::armpp::log::site<RATE> armpp_log_site;                           \
+            if (auto armpp_log_admission = armpp_log_site.admit()) {                            \
+                ::armpp::log::write(SINK, ::armpp::log::level::LEVEL, armpp_log_admission,      \
+                                    __VA_ARGS__);                                               \
+            }                                                                                   \
+        }                                                                                       \
+    } while (false)
+
+/**
+ * @brief Log a message with the default rate
+ */
+#define ARMPP_LOG(LEVEL, SINK, ...) \
+    ARMPP_LOG_RATE(LEVEL, ::armpp::log::default_rate, SINK, __VA_ARGS__)
@@ -0,0 +1,403 @@
+#pragma once
+
+#include <armpp/coro/task.hpp>
+#include <armpp/coro/uart.hpp>
+#include <armpp/util/fixed_string.hpp>
+#include <armpp/util/from_chars.hpp>
+#include <armpp/util/perfect_hash.hpp>
+#include <armpp/util/to_chars.hpp>
+#include <armpp/util/tokenizer.hpp>
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+/**
+ * @namespace armpp::shell
+ * @brief Command shell over a UART
+ *
+ * The commands are a compile-time list, each one is a name, a handler function and a help line.
+ * The line is split into tokens, the first one is looked up with a perfect hash built at compile
+ * time and the rest are parsed into the types of the handler parameters:
+ *
+ * ```c++
+ * void
+ * peek(shell::response& out, std::uint32_t address)
+ * {
+ *     out.write(*reinterpret_cast<std::uint32_t volatile*>(address), util::number_base::hex, 8,
+ *               '0');
+ * }
+ *
+ * using service_shell = shell::shell<shell::command<"peek", peek, "<address>, read a word">,
+ *                                    shell::command<"baud", set_baud, "<rate>, set baud rate">>;
+ *
+ * service_shell shell;
+ * executor.spawn(shell.serve(port));
+ * ```
+ */
+namespace armpp::shell {
+
+using util::fixed_string;
+
+enum class status : std::uint8_t {
+    ok,
+    empty_line,       /**< Nothing to execute */
+    unknown_command,  /**< The first token is not a command name */
+    missing_argument, /**< Fewer arguments than the handler parameters */
+    invalid_argument, /**< An argument cannot be parsed into the parameter type */
+    extra_argument,   /**< More arguments than the handler parameters */
+    failed,           /**< The handler reported an error */
+};
+
+constexpr std::string_view
+to_string(status val) noexcept
+{
+    switch (val) {
+    case status::ok:
+    case status::empty_line:
+        return {};
+    case status::unknown_command:
+        return "unknown command";
+    case status::missing_argument:
+        return "missing argument";
+    case status::invalid_argument:
+        return "invalid argument";
+    case status::extra_argument:
+        return "too many arguments";
+    case status::failed:
+        return "failed";
+    }
+    return {};
+}
+
+//----------------------------------------------------------------------------
+/**
+ * @class response
+ * @brief Output of a command, collected in a buffer owned by the shell
+ *
+ * The handlers run synchronously, the shell writes the whole response with one non-blocking
+ * write afterwards. Output that doesn't fit is dropped and the response is marked truncated.
+ */
+class response {
+public:
+    constexpr explicit response(std::span<char> buffer) noexcept : buffer_{buffer} {}
+
+    response&
+    operator<<(char c) noexcept
+    {
+        if (size_ < buffer_.size()) {
+            buffer_[size_++] = c;
+        } else {
+            truncated_ = true;
+        }
+        return *this;
+    }
+
+    response&
+    operator<<(std::string_view str) noexcept
+    {
+        auto count = std::min(str.size(), buffer_.size() - size_);
+        std::copy_n(str.data(), count, buffer_.data() + size_);
+        size_ += count;
+        truncated_ |= count < str.size();
+        return *this;
+    }
+
+    response&
+    operator<<(char const* str) noexcept
+    {
+        return *this << std::string_view{str};
+    }
+
+    template <std::integral Integer>
+        requires(!std::same_as<Integer, char> && !std::same_as<Integer, bool>)
+    response&
+    operator<<(Integer val) noexcept
+    {
+        return write(val, util::number_base::dec);
+    }
+
+    /**
+     * @brief Write an integer value with a given number base and width
+     */
+    template <std::integral Integer>
+    response&
+    write(Integer val, util::number_base base, std::int8_t width = 0, char fill = ' ') noexcept
+    {
+        char buffer[util::to_chars_buffer_size<Integer>];
+        util::to_chars(buffer, sizeof(buffer), val, base, width, fill);
+        return *this << std::string_view{buffer};
+    }
+
+    std::string_view
+    view() const noexcept
+    {
+        return {buffer_.data(), size_};
+    }
+
+    bool
+    truncated() const noexcept
+    {
+        return truncated_;
+    }
+
+    void
+    clear() noexcept
+    {
+        size_      = 0;
+        truncated_ = false;
+    }
+
+private:
+    std::span<char> buffer_;
+    std::size_t     size_      = 0;
+    bool            truncated_ = false;
+};
+
+//----------------------------------------------------------------------------
+//@{
+/**
+ * @name Argument parsing
+ *
+ * Overloads of `parse_argument` for other parameter types are found by ADL.
+ */
+/**
+ * @brief Integer argument, decimal or with a `0x`, `0o` or `0b` prefix
+ */
+template <std::integral Integer>
+    requires(!std::same_as<Integer, bool>)
+constexpr bool
+parse_argument(std::string_view token, Integer& value) noexcept
+{
+    auto base = util::number_base::dec;
+    if (token.size() > 2 && token[0] == '0') {
+        switch (token[1] | 0x20) {
+        case 'x':
+            base = util::number_base::hex;
+            break;
+        case 'o':
+            base = util::number_base::oct;
+            break;
+        case 'b':
+            base = util::number_base::bin;
+            break;
+        default:
+            break;
+        }
+        if (base != util::number_base::dec)
+            token.remove_prefix(2);
+    }
+    return util::from_chars(token, value, base);
+}
+
+/**
+ * @brief Boolean argument, `1`, `on`, `true` or `0`, `off`, `false`
+ */
+constexpr bool
+parse_argument(std::string_view token, bool& value) noexcept
+{
+    if (token == "1" || token == "on" || token == "true") {
+        value = true;
+        return true;
+    }
+    if (token == "0" || token == "off" || token == "false") {
+        value = false;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief The token as is, a view into the input line
+ */
+constexpr bool
+parse_argument(std::string_view token, std::string_view& value) noexcept
+{
+    value = token;
+    return true;
+}
+//@}
+
+namespace detail {
+
+template <typename Result, typename... Args>
+status
+invoke(Result (*handler)(response&, Args...), util::tokenizer& args, response& out)
+{
+    std::tuple<std::remove_cvref_t<Args>...> values{};
+
+    auto result = status::ok;
+    std::apply(
+        [&](auto&... value) {
+            [[maybe_unused]] auto parse = [&](auto& val) {
+                if (result != status::ok)
+                    return;
+                auto token = args.next();
+                if (token.empty()) {
+                    result = status::missing_argument;
+                } else if (!parse_argument(token, val)) {
+                    result = status::invalid_argument;
+                }
+            };
+            (parse(value), ...);
+        },
+        values);
+    if (result == status::ok && !args.empty())
+        result = status::extra_argument;
+    if (result != status::ok)
+        return result;
+
+    auto call = [&](auto&... value) { return handler(out, value...); };
+    if constexpr (std::is_same_v<Result, status>) {
+        return std::apply(call, values);
+    } else if constexpr (std::is_same_v<Result, bool>) {
+        return std::apply(call, values) ? status::ok : status::failed;
+    } else {
+        std::apply(call, values);
+        return status::ok;
+    }
+}
+
+}    // namespace detail
+
+/**
+ * @brief A command of a shell
+ *
+ * The handler is a function or a lambda without captures taking a `response&` and the arguments.
+ * It can return `void`, `bool` (false is a failure) or `status`.
+ *
+ * @tparam Name Command name, the first token of the line
+ * @tparam Handler Command handler
+ * @tparam Help Arguments and description, printed after the name by the built-in `help` command
+ */
+template <fixed_string Name, auto Handler, fixed_string Help = "">
+struct command {
+    static constexpr std::string_view name = Name.view();
+    static constexpr std::string_view help = Help.view();
+
+    static status
+    invoke(util::tokenizer& args, response& out)
+    {
+        return detail::invoke(+Handler, args, out);
+    }
+};
+
+//----------------------------------------------------------------------------
+/**
+ * @class basic_shell
+ * @brief Reads command lines from a UART, executes them and writes the responses
+ *
+ * The command names, the hash table and the handler table are `constexpr` and stay in flash, the
+ * shell object holds only the line and the response buffers. There is a built-in `help` command
+ * listing the commands.
+ *
+ * @tparam LineLength Maximum length of the input line, the rest of a longer line is dropped
+ * @tparam ResponseLength Size of the response buffer
+ * @tparam Commands `command` types
+ */
+template <std::size_t LineLength, std::size_t ResponseLength, typename... Commands>
+class basic_shell {
+public:
+    static constexpr std::size_t line_length     = LineLength;
+    static constexpr std::size_t response_length = ResponseLength;
+
+public:
+    /**
+     * @brief Execute a line
+     * @param line Command and arguments
+     * @param out Command output
+     */
+    static status
+    execute(std::string_view line, response& out)
+    {
+        util::tokenizer tokens{line};
+        auto            name = tokens.next();
+        if (name.empty())
+            return status::empty_line;
+        auto index = names_.find(name);
+        if (index == names_.npos)
+            return status::unknown_command;
+        return handlers_[index](tokens, out);
+    }
+
+    /**
+     * @brief Serve the shell over a UART forever
+     *
+     * The input is echoed, backspace erases the last character. The prompt, the echo and the
+     * responses are written with the non-blocking writes of `async_uart`, other coroutines run
+     * while the TX interrupt drains them.
+     */
+    coro::task<>
+    serve(coro::async_uart& port, std::string_view prompt = "> ")
+    {
+        auto skip_lf = false;
+        while (true) {
+            co_await port.write(prompt);
+            std::size_t size = 0;
+            while (true) {
+                char c = co_await port.read();
+                if (c == '\n' && skip_lf) {
+                    skip_lf = false;
+                    continue;
+                }
+                skip_lf = c == '\r';
+                if (c == '\r' || c == '\n')
+                    break;
+                if (c == '\b' || c == 0x7f) {
+                    if (size > 0) {
+                        --size;
+                        co_await port.write("\b \b");
+                    }
+                } else if (size < line_length) {
+                    line_[size++] = c;
+                    co_await port.write(c);
+                }
+            }
+            co_await port.write("\r\n");
+
+            response out{response_};
+            auto     result = execute({line_.data(), size}, out);
+            if (auto message = to_string(result); !message.empty()) {
+                out << message << "\r\n";
+            }
+            co_await port.write(out.view());
+            if (out.truncated())
+                co_await port.write("...\r\n");
+        }
+    }
+
+private:
+    using handler_type = status (*)(util::tokenizer&, response&);
+
+    static status
+    help(util::tokenizer&, response& out)
+    {
+        auto line = [&](std::string_view name, std::string_view help) {
+            out << name;
+            if (!help.empty())
+                out << ' ' << help;
+            out << "\r\n";
+        };
+        (line(Commands::name, Commands::help), ...);
+        return status::ok;
+    }
+
+    static constexpr util::perfect_hash<sizeof...(Commands) + 1> names_{
+        std::array<std::string_view, sizeof...(Commands) + 1>{Commands::name..., "help"}};
+    static constexpr std::array<handler_type, sizeof...(Commands) + 1> handlers_{
+        &Commands::invoke..., &help};
+
+    std::array<char, line_length>     line_{};
+    std::array<char, response_length> response_{};
+};
+
+template <typename... Commands>
+using shell = basic_shell<80, 256, Commands...>;
+
+}    // namespace armpp::shell
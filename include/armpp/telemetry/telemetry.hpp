@@ -0,0 +1,339 @@
+#pragma once
+
+#include <armpp/hal/uart.hpp>
+#include <armpp/util/fixed_string.hpp>
+#include <armpp/util/meta_utility.hpp>
+#include <armpp/util/traits.hpp>
+#include <armpp/util/varint.hpp>
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * @namespace armpp::telemetry
+ * @brief Binary telemetry records described at compile time
+ *
+ * A schema lists the fields of a record type with a name and a wire encoding for each one:
+ *
+ * ```c++
+ * struct motor_sample {
+ *     std::uint32_t tick;
+ *     std::int16_t  current;
+ *     std::uint16_t speed;
+ *     motor_state   state;
+ * };
+ *
+ * using motor_schema = telemetry::schema<"motor", 1,
+ *     telemetry::field<"tick", &motor_sample::tick, telemetry::encoding::delta>,
+ *     telemetry::field<"current", &motor_sample::current, telemetry::encoding::delta>,
+ *     telemetry::field<"speed", &motor_sample::speed>,
+ *     telemetry::field<"state", &motor_sample::state>>;
+ *
+ * telemetry::encoder<motor_schema> motor_telemetry;
+ * motor_telemetry.write_schema(uart0);
+ * motor_telemetry.write(uart0, sample);
+ * ```
+ *
+ * The stream is a sequence of frames, a length byte (the size of the rest of the frame), a header
+ * byte (the schema id and the frame kind) and the payload. A schema frame carries the names and
+ * the types of the fields, `tools/telemetry_decode.py` builds its decoder from it, so the host side
+ * always matches the firmware. A sample frame is the field values in the schema order:
+ * - `fixed`: the value as is, little-endian
+ * - `varint`: LEB128, zigzag mapped for signed types
+ * - `delta`: the difference to the field of the previous sample as a zigzag LEB128, the value
+ *   itself in key samples
+ *
+ * Every `KeyInterval`-th sample of an encoder is a key sample, a decoder that joins late or lost
+ * a frame recovers on the next one.
+ */
+namespace armpp::telemetry {
+
+using util::fixed_string;
+
+enum class encoding : std::uint8_t {
+    fixed,  /**< Little-endian, the size of the type */
+    varint, /**< LEB128, zigzag mapped for signed types */
+    delta,  /**< Difference to the previous sample, zigzag LEB128 */
+};
+
+enum class frame_kind : std::uint8_t {
+    key,    /**< Sample with all the values absolute */
+    delta,  /**< Sample with the `delta` fields relative to the previous one */
+    schema, /**< Description of the fields */
+};
+
+namespace detail {
+
+template <typename T>
+constexpr auto
+to_wire(T value) noexcept
+{
+    if constexpr (std::is_same_v<T, bool>) {
+        return static_cast<std::uint8_t>(value);
+    } else if constexpr (std::is_enum_v<T>) {
+        return static_cast<std::underlying_type_t<T>>(value);
+    } else {
+        return value;
+    }
+}
+
+template <typename T>
+using wire_type = decltype(to_wire(T{}));
+
+template <std::integral T>
+constexpr auto
+to_unsigned(T value) noexcept
+{
+    if constexpr (std::is_signed_v<T>) {
+        return util::zigzag_encode(value);
+    } else {
+        return value;
+    }
+}
+
+template <std::unsigned_integral T>
+char*
+put_le(T value, char* out) noexcept
+{
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+        *out++ = static_cast<char>(value >> (i * 8));
+    }
+    return out;
+}
+
+constexpr std::uint8_t
+size_code(std::size_t size) noexcept
+{
+    return size == 1 ? 0 : size == 2 ? 1 : size == 4 ? 2 : 3;
+}
+
+}    // namespace detail
+
+/**
+ * @brief A field of a schema
+ * @tparam Name Field name, reported to the host
+ * @tparam Member Pointer to the data member
+ * @tparam Encoding Wire encoding, `varint` and `delta` take integers, booleans and enumerations
+ */
+template <fixed_string Name, auto Member, encoding Encoding = encoding::varint>
+struct field {
+    using member_traits = util::traits::member_pointer<decltype(Member)>;
+    using record_type   = typename member_traits::class_type;
+    using value_type    = std::remove_cv_t<typename member_traits::member_type>;
+    using wire_type     = detail::wire_type<value_type>;
+
+    static_assert(std::is_arithmetic_v<wire_type>, "Telemetry fields are numbers");
+    static_assert(Encoding == encoding::fixed || std::is_integral_v<wire_type>,
+                  "Floating point fields are fixed size");
+    static_assert(Name.view().size() < 0x100, "Field names are up to 255 characters");
+
+    static constexpr std::string_view name           = Name.view();
+    static constexpr encoding         field_encoding = Encoding;
+    static constexpr std::size_t      max_size       = [] {
+        if constexpr (Encoding == encoding::fixed) {
+            return sizeof(wire_type);
+        } else {
+            return util::max_varint_size<wire_type>;
+        }
+    }();
+
+    /** Size, signedness and encoding of the field, as sent in the schema frame */
+    static constexpr std::uint8_t type_code
+        = detail::size_code(sizeof(wire_type)) | std::is_signed_v<wire_type> << 2
+        | std::is_floating_point_v<wire_type> << 3 | static_cast<std::uint8_t>(Encoding) << 4;
+
+    /**
+     * @brief Encode the field of a record
+     * @param previous The previous sample, nullptr in a key sample
+     */
+    static char*
+    encode(record_type const& record, record_type const* previous, char* out) noexcept
+    {
+        auto value = detail::to_wire(record.*Member);
+        if constexpr (Encoding == encoding::fixed) {
+            using unsigned_type = std::conditional_t<
+                sizeof(wire_type) == 1, std::uint8_t,
+                std::conditional_t<sizeof(wire_type) == 2, std::uint16_t,
+                                   std::conditional_t<sizeof(wire_type) == 4, std::uint32_t,
+                                                      std::uint64_t>>>;
+            return detail::put_le(std::bit_cast<unsigned_type>(value), out);
+        } else if constexpr (Encoding == encoding::delta) {
+            if (previous) {
+                // The wrapping difference, a counter that overflows is still a small delta
+                using unsigned_type = std::make_unsigned_t<wire_type>;
+                auto diff           = static_cast<unsigned_type>(
+                    static_cast<unsigned_type>(value)
+                    - static_cast<unsigned_type>(detail::to_wire(previous->*Member)));
+                return util::encode_varint(
+                    util::zigzag_encode(static_cast<std::make_signed_t<wire_type>>(diff)), out);
+            }
+            return util::encode_varint(detail::to_unsigned(value), out);
+        } else {
+            return util::encode_varint(detail::to_unsigned(value), out);
+        }
+    }
+};
+
+/**
+ * @brief Fields of a record type
+ * @tparam Name Record name, reported to the host
+ * @tparam Id Schema id in the frame headers, 0 to 63, unique on a link
+ * @tparam Fields `field` types in the wire order
+ */
+template <fixed_string Name, std::uint8_t Id, typename... Fields>
+struct schema {
+    static_assert(sizeof...(Fields) > 0, "A schema has at least one field");
+    static_assert(Id < 0x40, "Schema ids are 6 bit");
+
+    using record_type = typename util::first_type_t<Fields...>::record_type;
+    static_assert(util::are_same_v<record_type, typename Fields::record_type...>,
+                  "The fields of a schema are members of one type");
+
+    static constexpr std::string_view name = Name.view();
+    static constexpr std::uint8_t     id   = Id;
+
+    static constexpr bool has_delta = ((Fields::field_encoding == encoding::delta) || ...);
+
+    /** Largest sample frame, the length and the header bytes included */
+    static constexpr std::size_t max_frame_size = 2 + (Fields::max_size + ...);
+    static_assert(max_frame_size <= 0x100, "A frame is up to 255 bytes after the length");
+
+    static char*
+    encode(record_type const& record, record_type const* previous, char* out) noexcept
+    {
+        ((out = Fields::encode(record, previous, out)), ...);
+        return out;
+    }
+
+    static constexpr std::uint8_t
+    header(frame_kind kind) noexcept
+    {
+        return static_cast<std::uint8_t>(id << 2 | static_cast<std::uint8_t>(kind));
+    }
+
+    /** The schema frame: the record name, the field count, and the name and type of each field */
+    static constexpr auto schema_frame = [] {
+        constexpr auto size = 2 + 1 + name.size() + 1 + ((1 + Fields::name.size() + 1) + ...);
+        static_assert(size <= 0x100, "The schema frame is up to 255 bytes after the length");
+
+        std::array<char, size> frame{};
+        std::size_t            pos  = 0;
+        auto                   put  = [&](auto c) { frame[pos++] = static_cast<char>(c); };
+        auto                   text = [&](std::string_view str) {
+            put(str.size());
+            for (auto c : str) {
+                put(c);
+            }
+        };
+        put(size - 1);
+        put(header(frame_kind::schema));
+        text(name);
+        put(sizeof...(Fields));
+        ((text(Fields::name), put(Fields::type_code)), ...);
+        return frame;
+    }();
+};
+
+/**
+ * @class encoder
+ * @brief Writes the samples of a schema, keeps the previous sample for the delta fields
+ *
+ * The frames are encoded into a caller's buffer, e.g. a record reserved in a `uart_log`, or put
+ * into the UART data register directly:
+ *
+ * ```c++
+ * if (auto record = log.reserve(motor_telemetry.max_frame_size)) {
+ *     record.commit(motor_telemetry.encode(sample, record.data()));
+ * }
+ * ```
+ *
+ * @tparam Schema `schema` type
+ * @tparam KeyInterval Samples from one key sample to the next
+ */
+template <typename Schema, std::uint16_t KeyInterval = 16>
+class encoder {
+public:
+    using schema_type = Schema;
+    using record_type = typename schema_type::record_type;
+
+    static_assert(KeyInterval > 0, "The key interval is at least one sample");
+
+    static constexpr std::size_t max_frame_size = schema_type::max_frame_size;
+
+public:
+    constexpr encoder() noexcept = default;
+
+    /**
+     * @brief Encode a sample frame
+     * @param out Buffer of at least `max_frame_size` bytes
+     * @return Frame size, zero if the buffer is too small
+     */
+    std::size_t
+    encode(record_type const& sample, std::span<char> out) noexcept
+    {
+        if (out.size() < max_frame_size)
+            return 0;
+        auto key  = !schema_type::has_delta || count_ == 0;
+        auto last = schema_type::encode(sample, key ? nullptr : &previous_, out.data() + 2);
+        auto size = static_cast<std::size_t>(last - out.data());
+        out[0]    = static_cast<char>(size - 1);
+        out[1]    = static_cast<char>(
+            schema_type::header(key ? frame_kind::key : frame_kind::delta));
+        if constexpr (schema_type::has_delta) {
+            previous_ = sample;
+            count_    = static_cast<std::uint16_t>(count_ + 1 == KeyInterval ? 0 : count_ + 1);
+        }
+        return size;
+    }
+
+    /**
+     * @brief Write a sample frame to the UART
+     */
+    void
+    write(hal::uart::uart_handle& dev, record_type const& sample) noexcept
+    {
+        char buffer[max_frame_size];
+        auto size = encode(sample, buffer);
+        for (std::size_t i = 0; i < size; ++i) {
+            dev->put(buffer[i]);
+        }
+    }
+
+    /**
+     * @brief The schema frame, send it before the samples and when the host asks for it
+     */
+    static constexpr std::span<char const>
+    schema_frame() noexcept
+    {
+        return schema_type::schema_frame;
+    }
+
+    static void
+    write_schema(hal::uart::uart_handle& dev) noexcept
+    {
+        for (auto c : schema_type::schema_frame) {
+            dev->put(c);
+        }
+    }
+
+    /**
+     * @brief Make the next sample a key sample, e.g. when the host reconnects
+     */
+    void
+    reset() noexcept
+    {
+        count_ = 0;
+    }
+
+private:
+    record_type   previous_{};
+    std::uint16_t count_ = 0;
+};
+
+}    // namespace armpp::telemetry
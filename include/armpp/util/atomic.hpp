@@ -0,0 +1,285 @@
+#pragma once
+
+#include <armpp/hal/core.hpp>
+#include <armpp/hal/cpu.hpp>
+
+#include <atomic>
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
+
+namespace armpp::util {
+
+/**
+ * @brief The way read-modify-write operations on shared words are made atomic
+ */
+enum class atomic_mechanism {
+    exclusive_access, /*!< LDREX/STREX loop, ARMv7-M */
+    interrupt_mask,   /*!< PRIMASK critical section, ARMv6-M */
+    host              /*!< std::atomic */
+};
+
+template <typename Core = hal::core::current>
+constexpr atomic_mechanism default_atomic_mechanism
+    = !hal::core::on_target   ? atomic_mechanism::host
+    : Core::exclusive_access ? atomic_mechanism::exclusive_access
+                             : atomic_mechanism::interrupt_mask;
+
+/**
+ * @brief Load a word and mark the address for exclusive access (LDREX)
+ */
+template <typename Core = hal::core::current>
+inline std::uint32_t
+load_exclusive(std::uint32_t volatile* addr) noexcept
+{
+    static_assert(Core::exclusive_access,
+                  "LDREX/STREX are not implemented on ARMv6-M cores, use cpu::critical_section");
+    std::uint32_t result;
+    asm volatile("ldrex %0, [%1]" : "=r"(result) : "r"(addr) : "memory");
+    return result;
+}
+
+/**
+ * @brief Store a word if the exclusive access is still held (STREX)
+ * @return true if the store succeeded
+ */
+template <typename Core = hal::core::current>
+inline bool
+store_exclusive(std::uint32_t volatile* addr, std::uint32_t value) noexcept
+{
+    static_assert(Core::exclusive_access,
+                  "LDREX/STREX are not implemented on ARMv6-M cores, use cpu::critical_section");
+    std::uint32_t failed;
+    asm volatile("strex %0, %2, [%1]" : "=&r"(failed) : "r"(addr), "r"(value) : "memory");
+    return failed == 0;
+}
+
+/**
+ * @brief Drop the exclusive access (CLREX)
+ */
+template <typename Core = hal::core::current>
+inline void
+clear_exclusive() noexcept
+{
+    static_assert(Core::exclusive_access,
+                  "LDREX/STREX are not implemented on ARMv6-M cores, use cpu::critical_section");
+    asm volatile("clrex" ::: "memory");
+}
+
+/**
+ * @class atomic_word
+ * @brief A 32 bit value shared between interrupt handlers and thread mode
+ *
+ * On ARMv7-M read-modify-write operations are LDREX/STREX loops. An exception entry or return
+ * clears the exclusive monitor, so an operation interrupted by a handler touching the same word is
+ * retried, and the handler itself never waits. ARMv6-M cores have no exclusive access, the
+ * operations mask the interrupts for the few instructions they take. Cortex-M cores are single
+ * core, a compiler barrier is enough to order plain loads and stores.
+ *
+ * On the host the operations are `std::atomic` ones, so that the code using them can be exercised
+ * with threads.
+ */
+template <typename T = std::uint32_t, atomic_mechanism Mechanism = default_atomic_mechanism<>>
+    requires(std::integral<T> && sizeof(T) == sizeof(std::uint32_t))
+class atomic_word {
+public:
+    using value_type = T;
+
+    static constexpr atomic_mechanism mechanism = Mechanism;
+
+public:
+    constexpr atomic_word() noexcept = default;
+    constexpr explicit atomic_word(value_type val) noexcept : value_{val} {}
+
+    atomic_word(atomic_word const&) = delete;
+
+    atomic_word&
+    operator=(atomic_word const&)
+        = delete;
+
+    value_type
+    load() const noexcept
+    {
+        if constexpr (mechanism == atomic_mechanism::host) {
+            return value_.load(std::memory_order_acquire);
+        } else {
+            value_type val = value_;
+            asm volatile("" ::: "memory");
+            return val;
+        }
+    }
+
+    void
+    store(value_type val) noexcept
+    {
+        if constexpr (mechanism == atomic_mechanism::host) {
+            value_.store(val, std::memory_order_release);
+        } else {
+            asm volatile("" ::: "memory");
+            value_ = val;
+        }
+    }
+
+    /**
+     * @brief Compare and swap
+     *
+     * On failure `expected` is updated with the current value.
+     */
+    bool
+    compare_exchange(value_type& expected, value_type desired) noexcept
+    {
+        if constexpr (mechanism == atomic_mechanism::exclusive_access) {
+            auto addr = word_address();
+            while (true) {
+                auto current = static_cast<value_type>(load_exclusive(addr));
+                if (current != expected) {
+                    clear_exclusive();
+                    expected = current;
+                    return false;
+                }
+                if (store_exclusive(addr, static_cast<std::uint32_t>(desired)))
+                    return true;
+            }
+        } else if constexpr (mechanism == atomic_mechanism::interrupt_mask) {
+            hal::cpu::critical_section cs;
+            value_type                 current = value_;
+            if (current != expected) {
+                expected = current;
+                return false;
+            }
+            value_ = desired;
+            return true;
+        } else {
+            return value_.compare_exchange_strong(expected, desired, std::memory_order_acq_rel,
+                                                  std::memory_order_acquire);
+        }
+    }
+
+    /**
+     * @brief Atomically add a value
+     * @return The value before the addition
+     */
+    value_type
+    fetch_add(value_type val) noexcept
+    {
+        if constexpr (mechanism == atomic_mechanism::exclusive_access) {
+            auto          addr = word_address();
+            std::uint32_t prev;
+            do {
+                prev = load_exclusive(addr);
+            } while (!store_exclusive(addr, prev + static_cast<std::uint32_t>(val)));
+            return static_cast<value_type>(prev);
+        } else if constexpr (mechanism == atomic_mechanism::interrupt_mask) {
+            hal::cpu::critical_section cs;
+            value_type                 prev = value_;
+            value_                          = prev + val;
+            return prev;
+        } else {
+            return value_.fetch_add(val, std::memory_order_acq_rel);
+        }
+    }
+
+private:
+    std::uint32_t volatile*
+    word_address() noexcept
+    {
+        return const_cast<std::uint32_t volatile*>(
+            reinterpret_cast<std::uint32_t volatile const*>(&value_));
+    }
+
+    using storage_type = std::conditional_t<mechanism == atomic_mechanism::host,
+                                            std::atomic<value_type>, value_type volatile>;
+
+    storage_type value_ = 0;
+};
+
+/**
+ * @brief Load a plain word published by another context, with acquire ordering
+ *
+ * For words that are not `atomic_word` objects, like headers in a byte buffer. An aligned word
+ * load is atomic on Cortex-M, a compiler barrier orders it.
+ */
+inline std::uint32_t
+load_acquire(std::uint32_t const& word) noexcept
+{
+    if constexpr (hal::core::on_target) {
+        std::uint32_t val = *const_cast<std::uint32_t const volatile*>(&word);
+        asm volatile("" ::: "memory");
+        return val;
+    } else {
+        return std::atomic_ref<std::uint32_t>{const_cast<std::uint32_t&>(word)}.load(
+            std::memory_order_acquire);
+    }
+}
+
+/**
+ * @brief Publish a plain word to another context, with release ordering
+ */
+inline void
+store_release(std::uint32_t& word, std::uint32_t value) noexcept
+{
+    if constexpr (hal::core::on_target) {
+        asm volatile("" ::: "memory");
+        *const_cast<std::uint32_t volatile*>(&word) = value;
+    } else {
+        std::atomic_ref<std::uint32_t>{word}.store(value, std::memory_order_release);
+    }
+}
+
+/**
+ * @brief Atomically set a bit in a word shared with interrupt handlers
+ *
+ * A word in a bit-band region is changed with a single store to the alias, otherwise the word is
+ * changed in a LDREX/STREX loop or with the interrupts masked, whatever the core supports.
+ */
+template <typename Core = hal::core::current>
+inline void
+set_bit(std::uint32_t volatile& word, std::uint32_t bit) noexcept
+{
+    auto addr = static_cast<hal::address>(reinterpret_cast<std::uintptr_t>(&word));
+    if constexpr (hal::core::on_target && Core::bitband) {
+        if (hal::core::bitband_addressable<Core>(addr)) {
+            *reinterpret_cast<std::uint32_t volatile*>(hal::core::bitband_alias<Core>(addr, bit))
+                = 1;
+            return;
+        }
+    }
+    if constexpr (default_atomic_mechanism<Core> == atomic_mechanism::exclusive_access) {
+        std::uint32_t prev;
+        do {
+            prev = load_exclusive<Core>(&word);
+        } while (!store_exclusive<Core>(&word, prev | (1u << bit)));
+    } else {
+        hal::cpu::critical_section cs;
+        word = word | (1u << bit);
+    }
+}
+
+/**
+ * @brief Atomically clear a bit in a word shared with interrupt handlers
+ * @see set_bit
+ */
+template <typename Core = hal::core::current>
+inline void
+clear_bit(std::uint32_t volatile& word, std::uint32_t bit) noexcept
+{
+    auto addr = static_cast<hal::address>(reinterpret_cast<std::uintptr_t>(&word));
+    if constexpr (hal::core::on_target && Core::bitband) {
+        if (hal::core::bitband_addressable<Core>(addr)) {
+            *reinterpret_cast<std::uint32_t volatile*>(hal::core::bitband_alias<Core>(addr, bit))
+                = 0;
+            return;
+        }
+    }
+    if constexpr (default_atomic_mechanism<Core> == atomic_mechanism::exclusive_access) {
+        std::uint32_t prev;
+        do {
+            prev = load_exclusive<Core>(&word);
+        } while (!store_exclusive<Core>(&word, prev & ~(1u << bit)));
+    } else {
+        hal::cpu::critical_section cs;
+        word = word & ~(1u << bit);
+    }
+}
+
+}    // namespace armpp::util
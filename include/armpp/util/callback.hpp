@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace armpp::util {
+
+template <typename Signature, std::size_t Size = 2 * sizeof(void*)>
+class callback;
+
+/**
+ * @class callback
+ * @brief Callable stored inside the object, for handlers registered by drivers
+ *
+ * Unlike `std::function`, the callback never allocates and is trivially destructible, the default
+ * constructor is `constexpr`, so tables of callbacks with static storage are constant initialized
+ * and need no constructor or destructor registration at startup. The callable must be trivially
+ * copyable and fit into `Size` bytes, a lambda capturing a pointer or two or a function pointer:
+ *
+ * ```c++
+ * util::callback<void(char)> on_rx = [this](char c) { buffer_.push(c); };
+ * ```
+ *
+ * @tparam Result Result type
+ * @tparam Args Argument types
+ * @tparam Size Storage size
+ */
+template <typename Result, typename... Args, std::size_t Size>
+class callback<Result(Args...), Size> {
+public:
+    static constexpr std::size_t storage_size = Size;
+
+public:
+    constexpr callback() noexcept = default;
+    constexpr callback(std::nullptr_t) noexcept {}
+
+    template <typename Function>
+        requires(!std::is_same_v<std::remove_cvref_t<Function>, callback>
+                 && std::is_invocable_r_v<Result, Function&, Args...>)
+    callback(Function&& function) noexcept
+    {
+        using function_type = std::remove_cvref_t<Function>;
+        static_assert(std::is_trivially_copyable_v<function_type>,
+                      "The callable must be trivially copyable");
+        static_assert(sizeof(function_type) <= storage_size,
+                      "The callable doesn't fit into the callback storage");
+        static_assert(alignof(function_type) <= alignof(void*),
+                      "The callable alignment is stricter than the callback storage");
+        ::new (static_cast<void*>(storage_)) function_type(std::forward<Function>(function));
+        invoke_ = [](void* storage, Args... args) -> Result {
+            return std::invoke(*std::launder(static_cast<function_type*>(storage)),
+                               std::forward<Args>(args)...);
+        };
+    }
+
+    Result
+    operator()(Args... args) const
+    {
+        return invoke_(storage_, std::forward<Args>(args)...);
+    }
+
+    constexpr explicit
+    operator bool() const noexcept
+    {
+        return invoke_ != nullptr;
+    }
+
+private:
+    using invoke_type = Result (*)(void*, Args...);
+
+    invoke_type                      invoke_ = nullptr;
+    alignas(void*) mutable std::byte storage_[storage_size]{};
+};
+
+}    // namespace armpp::util
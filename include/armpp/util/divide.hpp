@@ -0,0 +1,58 @@
+#pragma once
+
+#include <armpp/hal/core.hpp>
+
+#include <cstdint>
+
+namespace armpp::util {
+
+/**
+ * @brief Quotient and remainder of an unsigned division
+ */
+struct divmod_result {
+    std::uint32_t quot;
+    std::uint32_t rem;
+
+    constexpr bool
+    operator==(divmod_result const&) const
+        = default;
+};
+
+/**
+ * @brief Divide by 10 without a division instruction
+ *
+ * With a hardware divider or a 32x32->64 multiply the compiler turns the division by a constant
+ * into a reciprocal multiplication. ARMv6-M cores have neither, GCC calls the `__aeabi_uidivmod`
+ * library routine there, which takes up to a hundred cycles. The quotient is approximated with
+ * shifts and adds (n * 0.8 / 8) and corrected with the remainder, about 20 instructions without
+ * a branch.
+ */
+template <typename Core = hal::core::current>
+constexpr divmod_result
+divmod10(std::uint32_t value) noexcept
+{
+    if constexpr (Core::hardware_divide || Core::long_multiply) {
+        return {value / 10, value % 10};
+    } else {
+        std::uint32_t quot = (value >> 1) + (value >> 2);
+        quot += quot >> 4;
+        quot += quot >> 8;
+        quot += quot >> 16;
+        quot >>= 3;
+        std::uint32_t rem = value - quot * 10;
+        // The estimate is at most one short
+        std::uint32_t correction = (rem + 6) >> 4;
+        return {quot + correction, rem - correction * 10};
+    }
+}
+
+using armv6m_profile = hal::core::profile<hal::core::family::cortex_m0>;
+
+static_assert(divmod10<armv6m_profile>(0) == divmod_result{0, 0});
+static_assert(divmod10<armv6m_profile>(9) == divmod_result{0, 9});
+static_assert(divmod10<armv6m_profile>(10) == divmod_result{1, 0});
+static_assert(divmod10<armv6m_profile>(99) == divmod_result{9, 9});
+static_assert(divmod10<armv6m_profile>(1234567890) == divmod_result{123456789, 0});
+static_assert(divmod10<armv6m_profile>(0xffffffff) == divmod_result{429496729, 5});
+
+}    // namespace armpp::util
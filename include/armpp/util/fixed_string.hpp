@@ -0,0 +1,25 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <string_view>
+
+namespace armpp::util {
+
+/**
+ * @brief String literal as a template argument
+ */
+template <std::size_t N>
+struct fixed_string {
+    char value[N]{};
+
+    constexpr fixed_string(char const (&str)[N]) noexcept { std::copy_n(str, N, value); }
+
+    constexpr std::string_view
+    view() const noexcept
+    {
+        return {value, N - 1};
+    }
+};
+
+}    // namespace armpp::util
@@ -1,10 +1,17 @@
 #pragma once
 
+#include <armpp/hal/core.hpp>
 #include <armpp/util/concepts.hpp>
 #include <armpp/util/meta_utility.hpp>
 
+#include <bit>
 #include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
 #include <initializer_list>
+#include <iterator>
+#include <limits>
 #include <type_traits>
 #include <utility>
 
@@ -35,8 +42,87 @@ or_(std::initializer_list<T> const& vs) noexcept
     return or_(vs, std::make_index_sequence<vs.size()>{});
 }
 
+/**
+ * @brief Bit index of `1 << n` multiplied by the De Bruijn sequence 0x077cb531, by the top 5 bits
+ */
+constexpr std::uint8_t de_bruijn_bit_index[32] = {0,  1,  28, 2,  29, 14, 24, 3,  30, 22, 20,
+                                                  15, 25, 17, 4,  8,  31, 27, 13, 23, 21, 19,
+                                                  16, 7,  26, 12, 18, 6,  11, 5,  10, 9};
+
 }    // namespace detail
 
+//----------------------------------------------------------------------------
+// Bit scan
+/**
+ * @brief Number of the zero bits below the lowest set one, the width of `T` for zero
+ *
+ * ARMv7-M does it with RBIT and CLZ. ARMv6-M has neither and GCC calls a library routine, there
+ * the lowest set bit is isolated and looked up by a De Bruijn multiplication instead, a multiply
+ * and a table load.
+ */
+template <std::unsigned_integral T, typename Core = hal::core::current>
+constexpr int
+countr_zero(T value) noexcept
+{
+    if constexpr (Core::bit_scan || sizeof(T) > sizeof(std::uint32_t)) {
+        return std::countr_zero(value);
+    } else {
+        if (value == 0)
+            return std::numeric_limits<T>::digits;
+        std::uint32_t bits = value;
+        return detail::de_bruijn_bit_index[((bits & (0u - bits)) * 0x077cb531u) >> 27];
+    }
+}
+
+/**
+ * @brief Number of the zero bits above the highest set one, the width of `T` for zero
+ *
+ * CLZ on ARMv7-M, a library routine on ARMv6-M.
+ */
+template <std::unsigned_integral T>
+constexpr int
+countl_zero(T value) noexcept
+{
+    return std::countl_zero(value);
+}
+
+/**
+ * @brief Number of the set bits
+ */
+template <std::unsigned_integral T>
+constexpr int
+popcount(T value) noexcept
+{
+    return std::popcount(value);
+}
+
+/**
+ * @brief Call a function with the index of every set bit, from the lowest one up
+ *
+ * The loop runs once per set bit, whatever the width of the value.
+ */
+template <std::unsigned_integral T, std::invocable<int> Function>
+constexpr void
+for_each_set_bit(T value, Function&& function)
+{
+    while (value != 0) {
+        function(util::countr_zero(value));
+        value &= value - 1;
+    }
+}
+
+static_assert([] {
+    using armv6m_profile = hal::core::profile<hal::core::family::cortex_m0>;
+    for (int i = 0; i < 32; ++i) {
+        if (countr_zero<std::uint32_t, armv6m_profile>(0xffffffffu << i) != i)
+            return false;
+    }
+    return countr_zero<std::uint32_t, armv6m_profile>(0) == 32
+        && countr_zero<std::uint8_t, armv6m_profile>(0) == 8;
+}());
+
+//----------------------------------------------------------------------------
+// Flags
 template <concepts::enumeration T, std::size_t Bits = sizeof(T) * 8>
 class flags {
 public:
@@ -250,6 +336,151 @@ operator<<(flags<T, Bits> lhs, U rhs) noexcept
     return lhs <<= rhs;
 }
 
+//@{
+/** @name Bit scan */
+/**
+ * @brief The flags as an unsigned integer of the underlying type width, the bits above `Bits`
+ *        cleared
+ */
+template <concepts::enumeration T, std::size_t Bits>
+constexpr auto
+flag_bits(flags<T, Bits> value) noexcept
+{
+    using unsigned_type         = std::make_unsigned_t<std::underlying_type_t<T>>;
+    constexpr unsigned_type all = ~unsigned_type{0};
+    constexpr unsigned_type mask
+        = Bits >= std::numeric_limits<unsigned_type>::digits ? all : ~(all << Bits);
+    return static_cast<unsigned_type>(static_cast<unsigned_type>(value.underlying()) & mask);
+}
+
+/**
+ * @brief Bit index of the lowest set flag, the width of the underlying type if none is set
+ */
+template <concepts::enumeration T, std::size_t Bits>
+constexpr int
+countr_zero(flags<T, Bits> value) noexcept
+{
+    return util::countr_zero(flag_bits(value));
+}
+
+/**
+ * @brief Number of the clear bits above the highest set flag in the underlying type
+ */
+template <concepts::enumeration T, std::size_t Bits>
+constexpr int
+countl_zero(flags<T, Bits> value) noexcept
+{
+    return util::countl_zero(flag_bits(value));
+}
+
+/**
+ * @brief Number of the set flags
+ */
+template <concepts::enumeration T, std::size_t Bits>
+constexpr int
+popcount(flags<T, Bits> value) noexcept
+{
+    return util::popcount(flag_bits(value));
+}
+
+/**
+ * @brief Call a function with the bit index of every set flag, from the lowest one up
+ */
+template <concepts::enumeration T, std::size_t Bits, std::invocable<int> Function>
+constexpr void
+for_each_set_bit(flags<T, Bits> value, Function&& function)
+{
+    util::for_each_set_bit(flag_bits(value), std::forward<Function>(function));
+}
+
+/**
+ * @brief Range of the set flags in a value, each one as an enumerator, from the lowest bit up
+ *
+ * A step clears the lowest set bit, so walking a sparse status value costs a few instructions per
+ * set flag instead of a test per bit:
+ *
+ * ```c++
+ * for (auto event : util::set_flags(status)) {
+ *     handle(event);
+ * }
+ * ```
+ */
+template <concepts::enumeration T, std::size_t Bits>
+class set_flags_range {
+public:
+    using unsigned_type = decltype(flag_bits(std::declval<flags<T, Bits>>()));
+
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+
+        constexpr iterator() noexcept = default;
+        constexpr explicit iterator(unsigned_type bits) noexcept : bits_{bits} {}
+
+        constexpr value_type
+        operator*() const noexcept
+        {
+            return static_cast<value_type>(bits_ & (unsigned_type{0} - bits_));
+        }
+
+        constexpr iterator&
+        operator++() noexcept
+        {
+            bits_ &= bits_ - 1;
+            return *this;
+        }
+
+        constexpr iterator
+        operator++(int) noexcept
+        {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        constexpr bool
+        operator==(iterator const&) const noexcept
+            = default;
+
+        constexpr bool
+        operator==(std::default_sentinel_t) const noexcept
+        {
+            return bits_ == 0;
+        }
+
+    private:
+        unsigned_type bits_ = 0;
+    };
+
+public:
+    constexpr explicit set_flags_range(flags<T, Bits> value) noexcept : bits_{flag_bits(value)} {}
+
+    constexpr iterator
+    begin() const noexcept
+    {
+        return iterator{bits_};
+    }
+
+    constexpr std::default_sentinel_t
+    end() const noexcept
+    {
+        return {};
+    }
+
+private:
+    unsigned_type bits_;
+};
+
+template <concepts::enumeration T, std::size_t Bits>
+constexpr set_flags_range<T, Bits>
+set_flags(flags<T, Bits> value) noexcept
+{
+    return set_flags_range<T, Bits>{value};
+}
+//@}
+
 template <typename T>
 struct is_flags : std::false_type {};
 
@@ -0,0 +1,278 @@
+#pragma once
+
+#include <armpp/util/to_chars.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+
+namespace armpp::util {
+
+enum class from_chars_error {
+    none,                /**< The value is parsed */
+    invalid_argument,    /**< No digits at the start of the input */
+    result_out_of_range, /**< The number doesn't fit into the value type */
+};
+
+struct from_chars_result {
+    char const*      ptr; /**< First character not matching the number pattern */
+    from_chars_error ec;  /**< Error code */
+
+    constexpr explicit
+    operator bool() const noexcept
+    {
+        return ec == from_chars_error::none;
+    }
+};
+
+namespace detail {
+
+/**
+ * @brief Value of a digit character in a base, the base value or more if it is not a digit
+ */
+constexpr unsigned
+digit_value(char c, unsigned base) noexcept
+{
+    auto value = static_cast<unsigned>(static_cast<unsigned char>(c) - '0');
+    if (value < 10 || base <= 10)
+        return value;
+    value = static_cast<unsigned>((static_cast<unsigned char>(c) | 0x20) - 'a');
+    return value < 6 ? value + 10 : base;
+}
+
+/**
+ * @brief Four characters as a little-endian word, the first one in the lowest byte
+ *
+ * The byte loads are merged into one LDR on the cores with unaligned access, ARMv6-M keeps four
+ * LDRB.
+ */
+constexpr std::uint32_t
+load_chars4(char const* p) noexcept
+{
+    return static_cast<std::uint32_t>(static_cast<unsigned char>(p[0]))
+         | static_cast<std::uint32_t>(static_cast<unsigned char>(p[1])) << 8
+         | static_cast<std::uint32_t>(static_cast<unsigned char>(p[2])) << 16
+         | static_cast<std::uint32_t>(static_cast<unsigned char>(p[3])) << 24;
+}
+
+/**
+ * @brief All four characters of a word are decimal digits
+ */
+constexpr bool
+is_digits4(std::uint32_t chars) noexcept
+{
+    // '0'..'9' are 0x30..0x39, adding 6 pushes 0x3a and above out of the 0x3_ row
+    return ((chars & 0xf0f0f0f0u) | ((chars + 0x06060606u) & 0xf0f0f0f0u) >> 4) == 0x33333333u;
+}
+
+/**
+ * @brief Value of four decimal digits, SWAR with two multiplications
+ */
+constexpr std::uint32_t
+parse_digits4(std::uint32_t chars) noexcept
+{
+    chars -= 0x30303030u;
+    // Bytes 0 and 2 are now the two digit pairs
+    chars = chars * 10 + (chars >> 8);
+    return ((chars & 0x00ff00ffu) * (100u << 16 | 1u)) >> 16;
+}
+
+static_assert(is_digits4(load_chars4("0189")));
+static_assert(!is_digits4(load_chars4("01:9")));
+static_assert(!is_digits4(load_chars4("01/9")));
+static_assert(parse_digits4(load_chars4("1234")) == 1234);
+static_assert(parse_digits4(load_chars4("9999")) == 9999);
+static_assert(parse_digits4(load_chars4("0007")) == 7);
+
+constexpr bool
+is_digit(char c) noexcept
+{
+    return static_cast<unsigned>(c - '0') < 10;
+}
+
+template <std::unsigned_integral U>
+constexpr from_chars_result
+from_chars_dec(char const* first, char const* last, U& value, U limit) noexcept
+{
+    using accumulator_type
+        = std::conditional_t<(sizeof(U) < sizeof(std::uint32_t)), std::uint32_t, U>;
+
+    auto start = first;
+    while (first != last && *first == '0')
+        ++first;
+
+    // Up to `digits10` digits always fit, the digit after them is checked for the overflow
+    auto             fits = std::numeric_limits<U>::digits10;
+    accumulator_type acc  = 0;
+    for (; fits >= 8 && last - first >= 8; first += 8, fits -= 8) {
+        auto high = load_chars4(first);
+        auto low  = load_chars4(first + 4);
+        if (!is_digits4(high) || !is_digits4(low))
+            break;
+        acc = acc * 100000000u + (parse_digits4(high) * 10000u + parse_digits4(low));
+    }
+    for (; fits >= 4 && last - first >= 4; first += 4, fits -= 4) {
+        auto chars = load_chars4(first);
+        if (!is_digits4(chars))
+            break;
+        acc = acc * 10000u + parse_digits4(chars);
+    }
+    for (; fits > 0 && first != last && is_digit(*first); ++first, --fits) {
+        acc = acc * 10u + static_cast<unsigned>(*first - '0');
+    }
+    if (first == start)
+        return {start, from_chars_error::invalid_argument};
+
+    auto overflow = false;
+    if (first != last && is_digit(*first)) {
+        auto digit = static_cast<accumulator_type>(*first - '0');
+        overflow   = acc > limit / 10 || (acc == limit / 10 && digit > limit % 10);
+        acc        = acc * 10u + digit;
+        // The pattern takes all the digits, even the ones that cannot fit
+        while (++first != last && is_digit(*first))
+            overflow = true;
+    }
+    if (overflow || acc > limit)
+        return {first, from_chars_error::result_out_of_range};
+    value = static_cast<U>(acc);
+    return {first, from_chars_error::none};
+}
+
+template <std::unsigned_integral U>
+constexpr from_chars_result
+from_chars_pow2(char const* first, char const* last, U& value, U limit, unsigned base) noexcept
+{
+    constexpr auto bit_count = std::numeric_limits<U>::digits;
+
+    auto shift    = base == 16 ? 4u : base == 8 ? 3u : 1u;
+    auto start    = first;
+    auto overflow = false;
+    U    acc      = 0;
+    for (; first != last; ++first) {
+        auto digit = digit_value(*first, base);
+        if (digit >= base)
+            break;
+        // Power of two bases, no multiplication, the overflow is the bits shifted out
+        overflow |= (acc >> (bit_count - shift)) != 0;
+        acc = static_cast<U>(acc << shift | digit);
+    }
+    if (first == start)
+        return {start, from_chars_error::invalid_argument};
+    if (overflow || acc > limit)
+        return {first, from_chars_error::result_out_of_range};
+    value = acc;
+    return {first, from_chars_error::none};
+}
+
+}    // namespace detail
+
+/**
+ * @brief Parse an integer from a character range, the inverse of `to_chars`
+ *
+ * Follows `std::from_chars`: no leading whitespace and no base prefix, a minus sign only for
+ * signed types, hex digits in either case. The value is left unchanged on error. Decimal digits
+ * are checked and converted four or eight at a time, a 32 bit number takes one eight digit SWAR
+ * step and two multiply-adds instead of ten.
+ *
+ * ```c++
+ * std::uint32_t value;
+ * if (auto res = util::from_chars(token.begin(), token.end(), value, number_base::hex); res) {
+ *     // ...
+ * }
+ * ```
+ *
+ * @param first Start of the input
+ * @param last End of the input
+ * @param value Parsed value
+ * @param base The number base
+ * @return Pointer past the number and the error code
+ */
+template <std::integral Integer>
+constexpr from_chars_result
+from_chars(char const* first, char const* last, Integer& value,
+           number_base base = number_base::dec) noexcept
+{
+    using unsigned_type     = std::make_unsigned_t<Integer>;
+    constexpr auto positive = static_cast<unsigned_type>(std::numeric_limits<Integer>::max());
+
+    auto negative = false;
+    if constexpr (std::is_signed_v<Integer>) {
+        if (first != last && *first == '-') {
+            negative = true;
+            ++first;
+        }
+    }
+    auto limit = negative ? static_cast<unsigned_type>(positive + 1) : positive;
+
+    unsigned_type     result = 0;
+    from_chars_result res;
+    if (base == number_base::dec) {
+        res = detail::from_chars_dec(first, last, result, limit);
+    } else {
+        res = detail::from_chars_pow2(first, last, result, limit,
+                                      static_cast<unsigned>(base));
+    }
+    if (res.ec == from_chars_error::invalid_argument) {
+        // The minus sign alone is not a number
+        res.ptr = negative ? first - 1 : first;
+    } else if (res) {
+        value = negative ? static_cast<Integer>(unsigned_type{0} - result)
+                         : static_cast<Integer>(result);
+    }
+    return res;
+}
+
+/**
+ * @brief Parse a whole token as an integer, the value is left unchanged if it is not a number
+ * @return True if the token is a number in the base and the value fits
+ */
+template <std::integral Integer>
+constexpr bool
+from_chars(std::string_view token, Integer& value, number_base base = number_base::dec) noexcept
+{
+    Integer parsed{};
+    auto    res = from_chars(token.data(), token.data() + token.size(), parsed, base);
+    if (!res || res.ptr != token.data() + token.size())
+        return false;
+    value = parsed;
+    return true;
+}
+
+namespace detail {
+
+template <std::integral Integer>
+constexpr Integer
+parse_or(std::string_view token, Integer fallback, number_base base = number_base::dec)
+{
+    from_chars(token, fallback, base);
+    return fallback;
+}
+
+static_assert(parse_or<std::uint32_t>("0", 1) == 0);
+static_assert(parse_or<std::uint32_t>("4294967295", 1) == 4294967295u);
+static_assert(parse_or<std::uint32_t>("4294967296", 1) == 1);
+static_assert(parse_or<std::uint32_t>("00000000004294967295", 1) == 4294967295u);
+static_assert(parse_or<std::uint32_t>("123456789", 1) == 123456789);
+static_assert(parse_or<std::uint32_t>("12a", 1) == 1);
+static_assert(parse_or<std::uint32_t>("", 1) == 1);
+static_assert(parse_or<std::uint32_t>("-1", 1) == 1);
+static_assert(parse_or<std::int32_t>("-2147483648", 1) == -2147483647 - 1);
+static_assert(parse_or<std::int32_t>("2147483648", 1) == 1);
+static_assert(parse_or<std::int32_t>("-", 1) == 1);
+static_assert(parse_or<std::uint8_t>("255", 1) == 255);
+static_assert(parse_or<std::uint8_t>("256", 1) == 1);
+static_assert(parse_or<std::uint64_t>("18446744073709551615", 1) == 18446744073709551615ull);
+static_assert(parse_or<std::uint64_t>("18446744073709551616", 1) == 1);
+static_assert(parse_or<std::uint32_t>("DeadBeef", 1, number_base::hex) == 0xdeadbeef);
+static_assert(parse_or<std::uint32_t>("100000000", 1, number_base::hex) == 1);
+static_assert(parse_or<std::uint8_t>("377", 1, number_base::oct) == 0377);
+static_assert(parse_or<std::uint8_t>("400", 1, number_base::oct) == 1);
+static_assert(parse_or<std::uint8_t>("101", 1, number_base::bin) == 5);
+static_assert(parse_or<std::int8_t>("-80", 1, number_base::hex) == -128);
+
+}    // namespace detail
+
+}    // namespace armpp::util
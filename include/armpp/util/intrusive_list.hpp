@@ -0,0 +1,303 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace armpp::util {
+
+/**
+ * @brief Links of an element of an `intrusive_list`, the element type derives from it
+ *
+ * An unlinked node points to itself, so `linked()` is a check and `unlink()` of an unlinked node
+ * does nothing.
+ */
+class intrusive_list_node {
+public:
+    constexpr intrusive_list_node() noexcept : prev_{this}, next_{this} {}
+
+    intrusive_list_node(intrusive_list_node const&) = delete;
+    intrusive_list_node(intrusive_list_node&&)      = delete;
+
+    intrusive_list_node&
+    operator=(intrusive_list_node const&)
+        = delete;
+    intrusive_list_node&
+    operator=(intrusive_list_node&&)
+        = delete;
+
+    ~intrusive_list_node() { unlink(); }
+
+    bool
+    linked() const noexcept
+    {
+        return next_ != this;
+    }
+
+    /**
+     * @brief Remove the node from the list it is in
+     */
+    void
+    unlink() noexcept
+    {
+        prev_->next_ = next_;
+        next_->prev_ = prev_;
+        prev_        = this;
+        next_        = this;
+    }
+
+private:
+    template <typename T>
+        requires std::derived_from<T, intrusive_list_node>
+    friend class intrusive_list;
+
+    void
+    link_before(intrusive_list_node& pos) noexcept
+    {
+        prev_            = pos.prev_;
+        next_            = &pos;
+        pos.prev_->next_ = this;
+        pos.prev_        = this;
+    }
+
+    intrusive_list_node* prev_;
+    intrusive_list_node* next_;
+};
+
+/**
+ * @class intrusive_list
+ * @brief Doubly linked list of elements that carry their own links
+ *
+ * The list doesn't own nor allocate the elements, it links objects living elsewhere (statically
+ * allocated, on a stack, in a pool). Insertion and removal are O(1) and can't fail, an element
+ * removes itself from the list when destroyed. An element can be in one list at a time.
+ *
+ * ```c++
+ * struct timer_request : util::intrusive_list_node {
+ *     std::uint32_t deadline;
+ * };
+ *
+ * util::intrusive_list<timer_request> pending;
+ * timer_request                       request;
+ * request.deadline = 100;
+ * pending.push_back(request);
+ * ```
+ *
+ * @tparam T Element type, derived from `intrusive_list_node`
+ */
+template <typename T>
+    requires std::derived_from<T, intrusive_list_node>
+class intrusive_list {
+public:
+    using value_type = T;
+    using reference  = T&;
+
+    template <typename Value, typename Node>
+    class basic_iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type        = std::remove_const_t<Value>;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = Value*;
+        using reference         = Value&;
+
+        basic_iterator() noexcept = default;
+        explicit basic_iterator(Node* node) noexcept : node_{node} {}
+
+        reference
+        operator*() const noexcept
+        {
+            return static_cast<reference>(*node_);
+        }
+
+        pointer
+        operator->() const noexcept
+        {
+            return static_cast<pointer>(node_);
+        }
+
+        basic_iterator&
+        operator++() noexcept
+        {
+            node_ = node_->next_;
+            return *this;
+        }
+
+        basic_iterator
+        operator++(int) noexcept
+        {
+            auto tmp = *this;
+            node_    = node_->next_;
+            return tmp;
+        }
+
+        basic_iterator&
+        operator--() noexcept
+        {
+            node_ = node_->prev_;
+            return *this;
+        }
+
+        basic_iterator
+        operator--(int) noexcept
+        {
+            auto tmp = *this;
+            node_    = node_->prev_;
+            return tmp;
+        }
+
+        bool
+        operator==(basic_iterator const&) const noexcept
+            = default;
+
+    private:
+        friend class intrusive_list;
+        Node* node_ = nullptr;
+    };
+
+    using iterator       = basic_iterator<T, intrusive_list_node>;
+    using const_iterator = basic_iterator<T const, intrusive_list_node const>;
+
+public:
+    intrusive_list() noexcept = default;
+    ~intrusive_list() { clear(); }
+
+    intrusive_list(intrusive_list const&) = delete;
+    intrusive_list(intrusive_list&&)      = delete;
+
+    intrusive_list&
+    operator=(intrusive_list const&)
+        = delete;
+    intrusive_list&
+    operator=(intrusive_list&&)
+        = delete;
+
+    bool
+    empty() const noexcept
+    {
+        return !head_.linked();
+    }
+
+    /**
+     * @brief Number of elements, O(n)
+     */
+    std::size_t
+    size() const noexcept
+    {
+        std::size_t count = 0;
+        for (auto node = head_.next_; node != &head_; node = node->next_) {
+            ++count;
+        }
+        return count;
+    }
+
+    reference
+    front() noexcept
+    {
+        return static_cast<reference>(*head_.next_);
+    }
+
+    reference
+    back() noexcept
+    {
+        return static_cast<reference>(*head_.prev_);
+    }
+
+    iterator
+    begin() noexcept
+    {
+        return iterator{head_.next_};
+    }
+
+    iterator
+    end() noexcept
+    {
+        return iterator{&head_};
+    }
+
+    const_iterator
+    begin() const noexcept
+    {
+        return const_iterator{head_.next_};
+    }
+
+    const_iterator
+    end() const noexcept
+    {
+        return const_iterator{&head_};
+    }
+
+    /**
+     * @brief Link an element at the front, it is unlinked from its current list first
+     */
+    void
+    push_front(reference value) noexcept
+    {
+        insert(begin(), value);
+    }
+
+    /**
+     * @brief Link an element at the back, it is unlinked from its current list first
+     */
+    void
+    push_back(reference value) noexcept
+    {
+        insert(end(), value);
+    }
+
+    /**
+     * @brief Link an element before a position, it is unlinked from its current list first
+     * @return Iterator to the element
+     */
+    iterator
+    insert(iterator pos, reference value) noexcept
+    {
+        intrusive_list_node& node = value;
+        if (&node == pos.node_)
+            return pos;
+        node.unlink();
+        node.link_before(*pos.node_);
+        return iterator{&node};
+    }
+
+    void
+    pop_front() noexcept
+    {
+        head_.next_->unlink();
+    }
+
+    void
+    pop_back() noexcept
+    {
+        head_.prev_->unlink();
+    }
+
+    /**
+     * @brief Unlink an element
+     * @return Iterator to the element after the removed one
+     */
+    iterator
+    erase(iterator pos) noexcept
+    {
+        auto next = pos.node_->next_;
+        pos.node_->unlink();
+        return iterator{next};
+    }
+
+    /**
+     * @brief Unlink all the elements
+     */
+    void
+    clear() noexcept
+    {
+        while (!empty()) {
+            pop_front();
+        }
+    }
+
+private:
+    intrusive_list_node head_;
+};
+
+}    // namespace armpp::util
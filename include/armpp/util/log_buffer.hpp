@@ -0,0 +1,340 @@
+#pragma once
+
+#include <armpp/util/atomic.hpp>
+#include <armpp/util/message_queue.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <utility>
+
+namespace armpp::util {
+
+template <std::size_t Capacity>
+class log_buffer;
+
+/**
+ * @class log_record
+ * @brief Space reserved in a log buffer, committed when the record is destroyed
+ *
+ * An empty record means the reservation failed, writing to it does nothing.
+ */
+class log_record {
+public:
+    constexpr log_record() noexcept = default;
+
+    log_record(log_record const&) = delete;
+    log_record(log_record&& rhs) noexcept
+        : header_{std::exchange(rhs.header_, nullptr)},
+          data_{rhs.data_},
+          size_{rhs.size_},
+          record_words_{rhs.record_words_}
+    {}
+
+    log_record&
+    operator=(log_record const&)
+        = delete;
+    log_record&
+    operator=(log_record&&)
+        = delete;
+
+    ~log_record() { commit(); }
+
+    explicit
+    operator bool() const noexcept
+    {
+        return header_ != nullptr;
+    }
+
+    /**
+     * @brief The reserved space
+     */
+    std::span<char>
+    data() const noexcept
+    {
+        return {data_, header_ ? size_ : 0};
+    }
+
+    /**
+     * @brief Copy a string to the record at an offset, as much as fits
+     * @return Number of characters copied
+     */
+    std::size_t
+    write(std::size_t offset, std::string_view str) noexcept
+    {
+        if (!header_ || offset >= size_)
+            return 0;
+        auto count = std::min(str.size(), size_ - offset);
+        std::memcpy(data_ + offset, str.data(), count);
+        return count;
+    }
+
+    /**
+     * @brief Publish the record with the first `size` characters, the rest is dropped
+     */
+    void
+    commit(std::size_t size) noexcept
+    {
+        if (header_) {
+            store_release(*header_, committed_flag | record_words_ << words_shift
+                                        | static_cast<std::uint32_t>(std::min(size, size_)));
+            header_ = nullptr;
+        }
+    }
+
+    void
+    commit() noexcept
+    {
+        commit(size_);
+    }
+
+private:
+    template <std::size_t>
+    friend class log_buffer;
+
+    // Header word: commit and padding flags, the reserved space in words including the header and
+    // the committed data size
+    static constexpr std::uint32_t committed_flag = 0x80000000u;
+    static constexpr std::uint32_t padding_flag   = 0x40000000u;
+    static constexpr std::uint32_t words_shift    = 16;
+    static constexpr std::uint32_t words_mask     = 0x3fffu;
+    static constexpr std::uint32_t size_mask      = 0xffffu;
+
+    log_record(std::uint32_t* header, std::size_t size, std::uint32_t record_words) noexcept
+        : header_{header},
+          data_{reinterpret_cast<char*>(header + 1)},
+          size_{size},
+          record_words_{record_words}
+    {}
+
+    std::uint32_t* header_       = nullptr;
+    char*          data_         = nullptr;
+    std::size_t    size_         = 0;
+    std::uint32_t  record_words_ = 0;
+};
+
+/**
+ * @class log_buffer
+ * @brief Multi-producer single-consumer buffer of variable length records
+ *
+ * A producer reserves contiguous space for a record with a compare-and-swap on the tail index,
+ * fills it in place and commits it. Handlers of any priority and thread mode can log at the same
+ * time: a reservation never waits, an interrupting writer gets its own space after the one of the
+ * writer it preempted, and records are committed in any order. The consumer takes the records in
+ * the order they were reserved and stops at the first one not committed yet, so a preempted
+ * writer delays the output but is never overwritten or interleaved.
+ *
+ * A record is a header word (length and commit flag) and the data, padded to a word. A record
+ * that would wrap around the end of the storage is placed at the start, the space before the end
+ * is reserved as padding in the same compare-and-swap. The consumer clears the space it frees, an
+ * unwritten header always reads as not committed.
+ *
+ * ```c++
+ * if (auto record = log.reserve(16)) {
+ *     auto size = format(record.data());
+ *     record.commit(size);
+ * }
+ * ```
+ *
+ * @tparam Capacity Storage size in bytes, power of two
+ */
+template <std::size_t Capacity>
+class log_buffer {
+public:
+    using index_type = std::uint32_t;
+
+    static constexpr std::size_t capacity = Capacity;
+    static_assert(capacity >= 16 && (capacity & (capacity - 1)) == 0,
+                  "Log buffer capacity must be a power of two");
+    static_assert(capacity / sizeof(std::uint32_t) <= log_record::words_mask,
+                  "Record sizes are 14 bit word counts");
+
+    /** Largest record data size */
+    static constexpr std::size_t max_record_size = capacity / 2 - sizeof(std::uint32_t);
+
+public:
+    constexpr log_buffer() noexcept = default;
+
+    log_buffer(log_buffer const&) = delete;
+    log_buffer(log_buffer&&)      = delete;
+
+    log_buffer&
+    operator=(log_buffer const&)
+        = delete;
+    log_buffer&
+    operator=(log_buffer&&)
+        = delete;
+
+    //@{
+    /** @name Producer side */
+    /**
+     * @brief Reserve space for a record
+     * @return Empty record if there is not enough free space, the drop counter is incremented
+     */
+    log_record
+    reserve(std::size_t size) noexcept
+    {
+        if (size > max_record_size) {
+            dropped_.fetch_add(1);
+            return {};
+        }
+        auto       record_size = static_cast<index_type>(word_size + round_up(size));
+        index_type pos         = tail_.load();
+        index_type padding;
+        while (true) {
+            auto to_end = static_cast<index_type>(capacity - (pos & mask));
+            padding     = record_size > to_end ? to_end : 0;
+            if (pos + padding + record_size - head_.load() > capacity) {
+                dropped_.fetch_add(1);
+                return {};
+            }
+            if (tail_.compare_exchange(pos, pos + padding + record_size))
+                break;
+        }
+        if (padding) {
+            store_header(pos, log_record::committed_flag | log_record::padding_flag
+                                  | (padding / word_size) << log_record::words_shift);
+            pos += padding;
+        }
+        return log_record{header(pos), size, record_size / word_size};
+    }
+
+    /**
+     * @brief Log a string as one record
+     * @return false if the record was dropped
+     */
+    bool
+    write(std::string_view str) noexcept
+    {
+        auto record = reserve(str.size());
+        if (!record)
+            return false;
+        record.write(0, str);
+        return true;
+    }
+
+    /**
+     * @brief A record of `size` characters fits in the free space now
+     *
+     * Another producer can take the space first, a single producer can wait for the space this way
+     * without counting drops.
+     */
+    bool
+    fits(std::size_t size) const noexcept
+    {
+        if (size > max_record_size)
+            return false;
+        auto record_size = static_cast<index_type>(word_size + round_up(size));
+        auto pos         = tail_.load();
+        auto to_end      = static_cast<index_type>(capacity - (pos & mask));
+        auto padding     = record_size > to_end ? to_end : 0;
+        return pos + padding + record_size - head_.load() <= capacity;
+    }
+
+    /**
+     * @brief Number of the records dropped because the buffer was full
+     */
+    index_type
+    dropped() const noexcept
+    {
+        return dropped_.load();
+    }
+    //@}
+
+    //@{
+    /** @name Consumer side */
+    /**
+     * @brief Unread part of the oldest record, empty if it is not committed yet
+     */
+    std::span<char const>
+    read_span() noexcept
+    {
+        while (head_.load() != tail_.load()) {
+            auto value = load_header(head_.load());
+            if (!(value & log_record::committed_flag))
+                break;
+            auto size = value & log_record::size_mask;
+            if (!(value & log_record::padding_flag) && read_offset_ < size) {
+                return {reinterpret_cast<char const*>(header(head_.load()) + 1) + read_offset_,
+                        size - read_offset_};
+            }
+            release_record(value);
+        }
+        return {};
+    }
+
+    /**
+     * @brief Mark characters of the oldest record as read, the record is freed when all are read
+     */
+    void
+    consume(std::size_t count) noexcept
+    {
+        read_offset_ += static_cast<index_type>(count);
+        auto value = load_header(head_.load());
+        if (read_offset_ >= (value & log_record::size_mask))
+            release_record(value);
+    }
+
+    /**
+     * @brief The oldest record is committed, can be called from any context
+     */
+    bool
+    readable() const noexcept
+    {
+        auto pos = head_.load();
+        return pos != tail_.load()
+            && (load_acquire(words_[(pos & mask) / word_size]) & log_record::committed_flag);
+    }
+    //@}
+
+private:
+    static constexpr index_type mask      = capacity - 1;
+    static constexpr index_type word_size = sizeof(std::uint32_t);
+
+    static constexpr index_type
+    round_up(std::size_t size) noexcept
+    {
+        return static_cast<index_type>((size + word_size - 1) & ~std::size_t{word_size - 1});
+    }
+
+    std::uint32_t*
+    header(index_type pos) noexcept
+    {
+        return &words_[(pos & mask) / word_size];
+    }
+
+    std::uint32_t
+    load_header(index_type pos) noexcept
+    {
+        return load_acquire(*header(pos));
+    }
+
+    void
+    store_header(index_type pos, std::uint32_t value) noexcept
+    {
+        store_release(*header(pos), value);
+    }
+
+    void
+    release_record(std::uint32_t value) noexcept
+    {
+        auto size = (value >> log_record::words_shift & log_record::words_mask) * word_size;
+        // Zero the space before handing it back, the headers of the next records start unwritten
+        auto pos = head_.load();
+        std::memset(header(pos), 0, size);
+        read_offset_ = 0;
+        head_.store(pos + size);
+    }
+
+private:
+    alignas(queue_index_alignment) atomic_word<index_type> tail_;
+    alignas(queue_index_alignment) atomic_word<index_type> head_;
+    atomic_word<index_type> dropped_;
+    index_type              read_offset_ = 0;
+    std::uint32_t           words_[capacity / word_size]{};
+};
+
+}    // namespace armpp::util
@@ -0,0 +1,338 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace armpp::util {
+
+/**
+ * @brief LZSS stream format shared by the encoder, the decoder and `tools/lzss_decode.py`
+ *
+ * A bit stream, the most significant bit of a byte first. A token is
+ * - `1` and 8 bits: a literal byte
+ * - `0`, `WindowBits` bits of distance and `LengthBits` bits of length minus `min_match`: a copy
+ *   of earlier output, the distance is 1 to `window_size - 1` bytes back
+ * - `0` and `WindowBits` zero bits: a flush, the rest of the byte is padding
+ *
+ * The window is kept across flushes, a flushed stream continues with the history of the bytes
+ * before the flush.
+ */
+template <unsigned WindowBits, unsigned LengthBits>
+struct lzss_format {
+    static_assert(WindowBits >= 4 && WindowBits <= 12, "The window is 16 to 4096 bytes");
+    static_assert(LengthBits >= 2 && LengthBits < WindowBits,
+                  "The longest match must fit into the window");
+
+    static constexpr unsigned    window_bits = WindowBits;
+    static constexpr unsigned    length_bits = LengthBits;
+    static constexpr std::size_t window_size = std::size_t{1} << window_bits;
+    static constexpr std::size_t min_match   = 2;
+    static constexpr std::size_t max_match   = min_match + (std::size_t{1} << length_bits) - 1;
+};
+
+/**
+ * @class lzss_encoder
+ * @brief Streaming LZSS compressor with a small fixed window
+ *
+ * The input is taken a byte at a time, a token is written as soon as there is enough lookahead
+ * for the longest match, so the encoder holds at most one window and one match of input. The
+ * matches are found through hash chains over the byte pairs of the window, at most `MaxChain`
+ * candidates are compared per token. All the state is in the object, `3 * 2 * window_size`
+ * bytes and a few words, it is zero initialized and can live in `.bss`.
+ *
+ * ```c++
+ * util::lzss_encoder<> lzss;
+ * auto out = [&](char c) { uart0->put(c); };
+ * lzss.write("temperature 23.5\r\n", out);
+ * lzss.flush(out);
+ * ```
+ *
+ * @tparam WindowBits Window size as a power of two
+ * @tparam LengthBits Width of the match length field
+ * @tparam MaxChain Candidates compared for a match
+ */
+template <unsigned WindowBits = 8, unsigned LengthBits = 4, unsigned MaxChain = 16>
+class lzss_encoder : public lzss_format<WindowBits, LengthBits> {
+    using format = lzss_format<WindowBits, LengthBits>;
+
+public:
+    using format::length_bits;
+    using format::max_match;
+    using format::min_match;
+    using format::window_bits;
+    using format::window_size;
+
+public:
+    constexpr lzss_encoder() noexcept = default;
+
+    /**
+     * @brief Compress a byte
+     * @param out Output function taking a `char`
+     */
+    template <typename Output>
+    void
+    put(char c, Output&& out)
+    {
+        if (end_ == buffer_size)
+            slide();
+        buffer_[end_++] = c;
+        ++bytes_in_;
+        if (end_ - pos_ >= max_match)
+            encode_token(out);
+    }
+
+    template <typename Output>
+    void
+    write(std::string_view str, Output&& out)
+    {
+        for (auto c : str) {
+            put(c, out);
+        }
+    }
+
+    /**
+     * @brief Encode the buffered input and pad the stream to a byte
+     *
+     * The decoder outputs everything put before the flush. A flush costs up to two bytes, nothing
+     * if there was no input since the last one.
+     */
+    template <typename Output>
+    void
+    flush(Output&& out)
+    {
+        while (pos_ < end_) {
+            encode_token(out);
+        }
+        if (!pending_)
+            return;
+        put_bits(0, 1 + window_bits, out);
+        if (bit_count_ > 0)
+            put_bits(0, 8 - bit_count_, out);
+        pending_ = false;
+    }
+
+    /** Bytes put into the encoder */
+    std::uint32_t
+    bytes_in() const noexcept
+    {
+        return bytes_in_;
+    }
+
+    /** Bytes written to the output */
+    std::uint32_t
+    bytes_out() const noexcept
+    {
+        return bytes_out_;
+    }
+
+private:
+    using position_type = std::uint16_t;
+
+    static constexpr std::size_t buffer_size = window_size * 2;
+    static constexpr std::size_t window_mask = window_size - 1;
+
+    static constexpr std::size_t
+    hash(char first, char second) noexcept
+    {
+        auto pair = static_cast<std::uint32_t>(static_cast<unsigned char>(first)) << 8
+                  | static_cast<unsigned char>(second);
+        return (pair * 0x9e3779b1u) >> (32 - window_bits);
+    }
+
+    template <typename Output>
+    void
+    put_bits(std::uint32_t value, unsigned count, Output& out)
+    {
+        bits_ = bits_ << count | value;
+        bit_count_ += count;
+        while (bit_count_ >= 8) {
+            bit_count_ -= 8;
+            out(static_cast<char>(bits_ >> bit_count_));
+            ++bytes_out_;
+        }
+        pending_ = true;
+    }
+
+    // The positions are stored plus one in the hash chains, zero is the end of a chain
+    void
+    insert_up_to(std::size_t pos) noexcept
+    {
+        for (; hashed_ < pos && hashed_ + 1 < end_; ++hashed_) {
+            auto& head                   = head_[hash(buffer_[hashed_], buffer_[hashed_ + 1])];
+            prev_[hashed_ & window_mask] = head;
+            head                         = static_cast<position_type>(hashed_ + 1);
+        }
+    }
+
+    template <typename Output>
+    void
+    encode_token(Output& out)
+    {
+        auto limit = std::min(end_ - pos_, max_match);
+
+        std::size_t best_length   = 0;
+        std::size_t best_distance = 0;
+        if (limit >= min_match) {
+            insert_up_to(pos_);
+            auto candidate = head_[hash(buffer_[pos_], buffer_[pos_ + 1])];
+            for (unsigned chain = 0; candidate != 0 && chain < MaxChain; ++chain) {
+                std::size_t start    = candidate - 1u;
+                auto        distance = pos_ - start;
+                if (distance >= window_size)
+                    break;
+                std::size_t length = 0;
+                while (length < limit && buffer_[start + length] == buffer_[pos_ + length])
+                    ++length;
+                if (length > best_length) {
+                    best_length   = length;
+                    best_distance = distance;
+                    if (length == limit)
+                        break;
+                }
+                candidate = prev_[start & window_mask];
+            }
+        }
+
+        if (best_length >= min_match) {
+            put_bits(static_cast<std::uint32_t>(best_distance << length_bits
+                                                | (best_length - min_match)),
+                     1 + window_bits + length_bits, out);
+            pos_ += best_length;
+        } else {
+            put_bits(0x100u | static_cast<unsigned char>(buffer_[pos_]), 9, out);
+            ++pos_;
+        }
+        insert_up_to(pos_);
+    }
+
+    // Drop the older half of the buffer, the encoded part is at least a window long when the
+    // buffer is full
+    void
+    slide() noexcept
+    {
+        std::memcpy(buffer_.data(), buffer_.data() + window_size, window_size);
+        pos_ -= window_size;
+        end_ -= window_size;
+        hashed_ = hashed_ > window_size ? hashed_ - window_size : 0;
+        auto rebase = [](position_type& pos) {
+            pos = pos > window_size ? static_cast<position_type>(pos - window_size) : 0;
+        };
+        std::for_each(head_.begin(), head_.end(), rebase);
+        std::for_each(prev_.begin(), prev_.end(), rebase);
+    }
+
+private:
+    std::array<char, buffer_size>          buffer_{};
+    std::array<position_type, window_size> head_{};
+    std::array<position_type, window_size> prev_{};
+    std::size_t                            pos_       = 0;
+    std::size_t                            end_       = 0;
+    std::size_t                            hashed_    = 0;
+    std::uint32_t                          bits_      = 0;
+    unsigned                               bit_count_ = 0;
+    bool                                   pending_   = false;
+    std::uint32_t                          bytes_in_  = 0;
+    std::uint32_t                          bytes_out_ = 0;
+};
+
+/**
+ * @class lzss_decoder
+ * @brief Streaming decoder of the `lzss_encoder` output
+ *
+ * Takes the compressed stream a byte at a time and writes the decoded bytes as soon as a token is
+ * complete. Holds one window of output.
+ */
+template <unsigned WindowBits = 8, unsigned LengthBits = 4>
+class lzss_decoder : public lzss_format<WindowBits, LengthBits> {
+    using format = lzss_format<WindowBits, LengthBits>;
+
+public:
+    using format::length_bits;
+    using format::min_match;
+    using format::window_bits;
+    using format::window_size;
+
+public:
+    constexpr lzss_decoder() noexcept = default;
+
+    /**
+     * @brief Decode a byte of the stream
+     * @param out Output function taking a `char`
+     */
+    template <typename Output>
+    void
+    put(char c, Output&& out)
+    {
+        bits_ = bits_ << 8 | static_cast<unsigned char>(c);
+        bit_count_ += 8;
+        while (decode_token(out)) {}
+    }
+
+    template <typename Output>
+    void
+    write(std::string_view str, Output&& out)
+    {
+        for (auto c : str) {
+            put(c, out);
+        }
+    }
+
+private:
+    static constexpr std::size_t window_mask = window_size - 1;
+
+    std::uint32_t
+    peek(unsigned count) const noexcept
+    {
+        return (bits_ >> (bit_count_ - count)) & ((std::uint32_t{1} << count) - 1);
+    }
+
+    template <typename Output>
+    void
+    emit(char c, Output& out)
+    {
+        window_[pos_++ & window_mask] = c;
+        out(c);
+    }
+
+    template <typename Output>
+    bool
+    decode_token(Output& out)
+    {
+        if (bit_count_ < 1 + window_bits)
+            return false;
+        if (peek(1)) {
+            if (bit_count_ < 9)
+                return false;
+            bit_count_ -= 9;
+            emit(static_cast<char>(bits_ >> bit_count_), out);
+            return true;
+        }
+        auto distance = peek(1 + window_bits);
+        if (distance == 0) {
+            // Flush, the rest of the byte is padding
+            bit_count_ -= 1 + window_bits;
+            bit_count_ -= bit_count_ % 8;
+            return true;
+        }
+        if (bit_count_ < 1 + window_bits + length_bits)
+            return false;
+        bit_count_ -= 1 + window_bits + length_bits;
+        auto length = ((bits_ >> bit_count_) & ((1u << length_bits) - 1)) + min_match;
+        for (; length > 0; --length) {
+            emit(window_[(pos_ - distance) & window_mask], out);
+        }
+        return true;
+    }
+
+private:
+    std::array<char, window_size> window_{};
+    std::size_t                   pos_       = 0;
+    std::uint32_t                 bits_      = 0;
+    unsigned                      bit_count_ = 0;
+};
+
+}    // namespace armpp::util
@@ -0,0 +1,380 @@
+#pragma once
+
+#include <armpp/util/atomic.hpp>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+
+namespace armpp::util {
+
+/**
+ * @brief Alignment of the queue indexes
+ *
+ * Producer and consumer indexes are kept on separate cache lines on the host. Cortex-M3/M4 have no
+ * data cache, there the alignment would only waste RAM.
+ */
+#if defined(__arm__)
+constexpr std::size_t queue_index_alignment = alignof(std::uint32_t);
+#else
+constexpr std::size_t queue_index_alignment = 64;
+#endif
+
+/**
+ * @brief Wake policy that does nothing
+ *
+ * A wake policy is called by the producer after new elements are published. It can be used to
+ * wake a core waiting in WFE (`hal::cpu::event_notifier`) or to resume a coroutine
+ * (`coro::event`).
+ */
+struct no_wake {
+    constexpr void
+    notify() const noexcept
+    {}
+};
+
+template <typename T>
+concept wake_policy = requires(T& w) { w.notify(); };
+
+template <typename T>
+concept queue_element = std::default_initializable<T> && std::movable<T>;
+
+/**
+ * @class spsc_queue
+ * @brief Fixed capacity single-producer single-consumer queue
+ *
+ * Wait-free on both sides. The producer owns the tail index, the consumer owns the head, each side
+ * only reads the other's index, so neither side needs a read-modify-write operation. Typical use
+ * is an interrupt handler producing and thread mode consuming, or vice versa.
+ *
+ * Indexes run freely and are masked on access, so the capacity must be a power of two and all of
+ * the slots are usable.
+ *
+ * @tparam T Element type
+ * @tparam Capacity Number of elements, power of two
+ * @tparam Wake Wake policy, notified after a push
+ */
+template <queue_element T, std::size_t Capacity, wake_policy Wake = no_wake>
+class spsc_queue {
+public:
+    using value_type = T;
+    using index_type = std::uint32_t;
+    using wake_type  = Wake;
+
+    static constexpr std::size_t capacity = Capacity;
+    static_assert(capacity > 0 && (capacity & (capacity - 1)) == 0,
+                  "Queue capacity must be a power of two");
+
+public:
+    constexpr spsc_queue() noexcept = default;
+
+    spsc_queue(spsc_queue const&) = delete;
+    spsc_queue(spsc_queue&&)      = delete;
+
+    spsc_queue&
+    operator=(spsc_queue const&)
+        = delete;
+    spsc_queue&
+    operator=(spsc_queue&&)
+        = delete;
+
+    //@{
+    /** @name Producer side */
+    /**
+     * @brief Push an element
+     * @return false if the queue is full
+     */
+    bool
+    push(value_type value)
+    {
+        auto tail = tail_.load();
+        if (tail - head_.load() == capacity)
+            return false;
+        buffer_[tail & mask] = std::move(value);
+        tail_.store(tail + 1);
+        wake_.notify();
+        return true;
+    }
+
+    /**
+     * @brief Push as many elements as fit
+     *
+     * The elements are published and the wake policy is notified once.
+     *
+     * @return Number of elements pushed
+     */
+    std::size_t
+    push(std::span<value_type const> values)
+    {
+        auto tail  = tail_.load();
+        auto count = std::min<std::size_t>(values.size(), capacity - (tail - head_.load()));
+        if (count == 0)
+            return 0;
+        auto first = std::min<std::size_t>(count, capacity - (tail & mask));
+        std::copy_n(values.begin(), first, buffer_ + (tail & mask));
+        std::copy_n(values.begin() + first, count - first, buffer_);
+        tail_.store(tail + static_cast<index_type>(count));
+        wake_.notify();
+        return count;
+    }
+    //@}
+
+    //@{
+    /** @name Consumer side */
+    /**
+     * @brief Pop an element
+     * @return false if the queue is empty
+     */
+    bool
+    pop(value_type& value)
+    {
+        auto head = head_.load();
+        if (head == tail_.load())
+            return false;
+        value = std::move(buffer_[head & mask]);
+        head_.store(head + 1);
+        return true;
+    }
+
+    /**
+     * @brief Pop as many elements as available
+     * @return Number of elements popped
+     */
+    std::size_t
+    pop(std::span<value_type> values)
+    {
+        auto head  = head_.load();
+        auto count = std::min<std::size_t>(values.size(), tail_.load() - head);
+        if (count == 0)
+            return 0;
+        auto first = std::min<std::size_t>(count, capacity - (head & mask));
+        std::move(buffer_ + (head & mask), buffer_ + (head & mask) + first, values.begin());
+        std::move(buffer_, buffer_ + (count - first), values.begin() + first);
+        head_.store(head + static_cast<index_type>(count));
+        return count;
+    }
+    //@}
+
+    std::size_t
+    size() const noexcept
+    {
+        return tail_.load() - head_.load();
+    }
+
+    bool
+    empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    bool
+    full() const noexcept
+    {
+        return size() == capacity;
+    }
+
+    wake_type&
+    waker() noexcept
+    {
+        return wake_;
+    }
+
+private:
+    static constexpr index_type mask = capacity - 1;
+
+    alignas(queue_index_alignment) atomic_word<index_type> head_;
+    alignas(queue_index_alignment) atomic_word<index_type> tail_;
+    alignas(queue_index_alignment) value_type buffer_[capacity]{};
+    [[no_unique_address]] wake_type wake_;
+};
+
+/**
+ * @class mpsc_queue
+ * @brief Fixed capacity multi-producer single-consumer queue
+ *
+ * Producers claim slots with a compare-and-swap on the tail index (LDREX/STREX on the target),
+ * each slot carries a sequence number which tells the consumer that the slot is published and the
+ * producers that the slot is free. A producer never waits for another one, so handlers of any
+ * priority and thread mode can push concurrently. A producer preempted between claiming and
+ * publishing a slot only delays the consumer, the elements after it are kept in order.
+ *
+ * @tparam T Element type
+ * @tparam Capacity Number of elements, power of two
+ * @tparam Wake Wake policy, notified after a push
+ */
+template <queue_element T, std::size_t Capacity, wake_policy Wake = no_wake>
+class mpsc_queue {
+public:
+    using value_type = T;
+    using index_type = std::uint32_t;
+    using wake_type  = Wake;
+
+    static constexpr std::size_t capacity = Capacity;
+    static_assert(capacity > 0 && (capacity & (capacity - 1)) == 0,
+                  "Queue capacity must be a power of two");
+
+public:
+    constexpr mpsc_queue() noexcept = default;
+
+    mpsc_queue(mpsc_queue const&) = delete;
+    mpsc_queue(mpsc_queue&&)      = delete;
+
+    mpsc_queue&
+    operator=(mpsc_queue const&)
+        = delete;
+    mpsc_queue&
+    operator=(mpsc_queue&&)
+        = delete;
+
+    //@{
+    /** @name Producer side */
+    /**
+     * @brief Push an element
+     * @return false if the queue is full
+     */
+    bool
+    push(value_type value)
+    {
+        index_type pos;
+        if (!claim(1, pos))
+            return false;
+        cells_[pos & mask].value = std::move(value);
+        store_sequence(pos, pos + 1);
+        wake_.notify();
+        return true;
+    }
+
+    /**
+     * @brief Push a batch of elements with a single claim
+     *
+     * Either all the elements are pushed or none.
+     *
+     * @return false if there is not enough space
+     */
+    bool
+    push(std::span<value_type const> values)
+    {
+        if (values.empty())
+            return true;
+        if (values.size() > capacity)
+            return false;
+
+        auto       count = static_cast<index_type>(values.size());
+        index_type pos;
+        if (!claim(count, pos))
+            return false;
+        for (index_type i = 0; i < count; ++i) {
+            cells_[(pos + i) & mask].value = values[i];
+            store_sequence(pos + i, pos + i + 1);
+        }
+        wake_.notify();
+        return true;
+    }
+    //@}
+
+    //@{
+    /** @name Consumer side */
+    /**
+     * @brief Pop an element
+     * @return false if the queue is empty or the next element is not published yet
+     */
+    bool
+    pop(value_type& value)
+    {
+        if (load_sequence(head_) != head_ + 1)
+            return false;
+        value = std::move(cells_[head_ & mask].value);
+        store_sequence(head_, head_ + capacity);
+        ++head_;
+        return true;
+    }
+
+    /**
+     * @brief Pop the published elements
+     * @return Number of elements popped
+     */
+    std::size_t
+    pop(std::span<value_type> values)
+    {
+        std::size_t count = 0;
+        while (count < values.size() && pop(values[count])) {
+            ++count;
+        }
+        return count;
+    }
+    //@}
+
+    /**
+     * @brief Approximate number of elements, including the claimed but not published ones
+     */
+    std::size_t
+    size() const noexcept
+    {
+        return tail_.load() - head_;
+    }
+
+    bool
+    empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    wake_type&
+    waker() noexcept
+    {
+        return wake_;
+    }
+
+private:
+    static constexpr index_type mask = capacity - 1;
+
+    bool
+    claim(index_type count, index_type& pos)
+    {
+        pos = tail_.load();
+        while (true) {
+            // The consumer frees the cells in order, if the last cell of the range is free, so are
+            // the ones before it
+            auto last = pos + count - 1;
+            auto seq  = load_sequence(last);
+            auto diff = static_cast<std::int32_t>(seq - last);
+            if (diff == 0) {
+                if (tail_.compare_exchange(pos, pos + count))
+                    return true;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = tail_.load();
+            }
+        }
+    }
+
+    // The sequence numbers are stored relative to the cell index, the cells of an empty queue are
+    // all zero and a queue with static storage is constant initialized
+    index_type
+    load_sequence(index_type pos) const noexcept
+    {
+        return cells_[pos & mask].sequence.load() + (pos & mask);
+    }
+
+    void
+    store_sequence(index_type pos, index_type seq) noexcept
+    {
+        cells_[pos & mask].sequence.store(seq - (pos & mask));
+    }
+
+    struct cell {
+        atomic_word<index_type> sequence;
+        value_type              value{};
+    };
+
+    alignas(queue_index_alignment) atomic_word<index_type> tail_;
+    alignas(queue_index_alignment) index_type head_ = 0;
+    cell                            cells_[capacity];
+    [[no_unique_address]] wake_type wake_;
+};
+
+}    // namespace armpp::util
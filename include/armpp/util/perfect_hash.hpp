@@ -0,0 +1,189 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+
+namespace armpp::util {
+
+/**
+ * @brief FNV-1a hash of a string with a seed, finalized so that the low bits depend on all the
+ *        characters
+ */
+constexpr std::uint32_t
+seeded_hash(std::string_view str, std::uint32_t seed) noexcept
+{
+    std::uint32_t hash = 0x811c9dc5u ^ seed;
+    for (auto c : str) {
+        hash = (hash ^ static_cast<unsigned char>(c)) * 0x01000193u;
+    }
+    return hash ^ (hash >> 15);
+}
+
+namespace detail {
+
+// Not constexpr, calling them from the constructor of a constexpr object fails compilation
+inline void
+perfect_hash_duplicate_key()
+{}
+
+inline void
+perfect_hash_seed_not_found()
+{}
+
+}    // namespace detail
+
+/**
+ * @class perfect_hash
+ * @brief Collision-free hash table over a set of strings known at compile time
+ *
+ * Hash and displace: a first hash splits the keys into buckets of a key or two, each bucket has a
+ * seed of its own that puts its keys into free slots of the table. The buckets are placed the
+ * largest first, a bucket finds its seed in a few tries, so the construction time grows linearly
+ * with the number of keys. A lookup is two hashes of the string, a seed load, a slot load and one
+ * comparison with the key in the slot, whatever the number of keys. Built as a `constexpr` object,
+ * the tables live in flash:
+ *
+ * ```c++
+ * constexpr util::perfect_hash<3> names{{"peek", "poke", "baud"}};
+ * static_assert(names.find("poke") == 1);
+ * static_assert(names.find("reset") == names.npos);
+ * ```
+ *
+ * @tparam Size Number of keys
+ */
+template <std::size_t Size>
+class perfect_hash {
+public:
+    using index_type = std::conditional_t<(Size < 0xff), std::uint8_t, std::uint16_t>;
+    using seed_type  = std::uint16_t;
+
+    /** Number of slots, twice the number of keys keeps the seed search short */
+    static constexpr std::size_t table_size = std::bit_ceil(Size * 2 > 1 ? Size * 2 : 2);
+    /** Number of buckets, one to two keys per bucket on average */
+    static constexpr std::size_t bucket_count = table_size > 4 ? table_size / 4 : 1;
+    static constexpr std::size_t npos         = std::numeric_limits<std::size_t>::max();
+
+public:
+    /**
+     * @brief Build the table, the keys must be distinct
+     */
+    constexpr explicit perfect_hash(std::array<std::string_view, Size> const& keys) : keys_{keys}
+    {
+        for (auto& slot : slots_) {
+            slot = empty_slot;
+        }
+
+        // The keys sorted by bucket, a bucket is a range of `order`
+        std::array<std::size_t, bucket_count + 1> first{};
+        std::array<std::size_t, Size>             buckets{};
+        for (std::size_t i = 0; i < Size; ++i) {
+            buckets[i] = bucket(keys_[i]);
+            ++first[buckets[i] + 1];
+        }
+        std::size_t max_count = 0;
+        for (std::size_t b = 0; b < bucket_count; ++b) {
+            max_count = first[b + 1] > max_count ? first[b + 1] : max_count;
+            first[b + 1] += first[b];
+        }
+        std::array<index_type, Size> order{};
+        auto                         next = first;
+        for (std::size_t i = 0; i < Size; ++i) {
+            order[next[buckets[i]]++] = static_cast<index_type>(i);
+        }
+
+        for (auto count = max_count; count > 0; --count) {
+            for (std::size_t b = 0; b < bucket_count; ++b) {
+                if (first[b + 1] - first[b] == count)
+                    place(b, &order[first[b]], count);
+            }
+        }
+    }
+
+    /**
+     * @brief Index of the key, `npos` if the string is not one of the keys
+     */
+    constexpr std::size_t
+    find(std::string_view str) const noexcept
+    {
+        auto index = slots_[slot(str, seeds_[bucket(str)])];
+        return index != empty_slot && keys_[index] == str ? index : npos;
+    }
+
+    constexpr std::string_view
+    key(std::size_t index) const noexcept
+    {
+        return keys_[index];
+    }
+
+    constexpr std::size_t
+    size() const noexcept
+    {
+        return Size;
+    }
+
+private:
+    static constexpr index_type empty_slot = std::numeric_limits<index_type>::max();
+
+    static constexpr std::size_t
+    bucket(std::string_view str) noexcept
+    {
+        return seeded_hash(str, 0) & (bucket_count - 1);
+    }
+
+    // The bucket seeds start from one, seed zero would repeat the bucket hash
+    static constexpr std::size_t
+    slot(std::string_view str, seed_type seed) noexcept
+    {
+        return seeded_hash(str, seed) & (table_size - 1);
+    }
+
+    constexpr void
+    place(std::size_t b, index_type const* members, std::size_t count)
+    {
+        // Equal keys share the bucket and the slot whatever the seed
+        for (std::size_t i = 0; i < count; ++i) {
+            for (std::size_t j = i + 1; j < count; ++j) {
+                if (keys_[members[i]] == keys_[members[j]])
+                    detail::perfect_hash_duplicate_key();
+            }
+        }
+
+        std::array<std::size_t, Size> taken{};
+        for (std::uint32_t seed = 1; seed <= std::numeric_limits<seed_type>::max(); ++seed) {
+            auto fits = true;
+            for (std::size_t i = 0; i < count && fits; ++i) {
+                taken[i] = slot(keys_[members[i]], static_cast<seed_type>(seed));
+                fits     = slots_[taken[i]] == empty_slot;
+                for (std::size_t j = 0; j < i && fits; ++j) {
+                    fits = taken[j] != taken[i];
+                }
+            }
+            if (fits) {
+                for (std::size_t i = 0; i < count; ++i) {
+                    slots_[taken[i]] = members[i];
+                }
+                seeds_[b] = static_cast<seed_type>(seed);
+                return;
+            }
+        }
+        detail::perfect_hash_seed_not_found();
+    }
+
+private:
+    std::array<std::string_view, Size>   keys_;
+    std::array<index_type, table_size>   slots_{};
+    std::array<seed_type, bucket_count>  seeds_{};
+};
+
+static_assert([] {
+    constexpr perfect_hash<3> names{{"peek", "poke", "baud"}};
+    return names.find("peek") == 0 && names.find("poke") == 1 && names.find("baud") == 2
+        && names.find("reset") == names.npos && names.find("") == names.npos;
+}());
+
+}    // namespace armpp::util
@@ -0,0 +1,346 @@
+#pragma once
+
+#include <armpp/hal/cpu.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace armpp::util {
+
+/**
+ * @brief Alignment of the pool blocks, the alignment `operator new` guarantees
+ */
+constexpr std::size_t pool_alignment = alignof(std::max_align_t);
+
+/**
+ * @brief Synchronization of the pool operations
+ */
+enum class pool_sync {
+    none,          /*!< The pool is used from one execution context */
+    interrupt_mask /*!< The operations mask the interrupts, the pool can be used from handlers */
+};
+
+/**
+ * @brief Size class of a pool allocator
+ */
+struct pool_class {
+    std::size_t block_size;
+    std::size_t block_count;
+};
+
+/**
+ * @brief Usage counters of a size class
+ */
+struct pool_stats {
+    std::size_t block_size;
+    std::size_t block_count;
+    std::size_t in_use;      ///< Blocks allocated now
+    std::size_t high_water;  ///< Maximum number of blocks allocated at once
+    std::size_t allocations; ///< Successful allocations
+    std::size_t failures;    ///< Requests made while the class was exhausted
+};
+
+namespace detail {
+
+struct no_pool_lock {
+    // User-provided, so that an unused guard doesn't warn
+    constexpr no_pool_lock() noexcept {}
+};
+
+template <pool_sync Sync>
+using pool_lock = std::conditional_t<Sync == pool_sync::interrupt_mask, hal::cpu::critical_section,
+                                     no_pool_lock>;
+
+}    // namespace detail
+
+/**
+ * @class fixed_pool
+ * @brief Statically allocated pool of fixed size blocks
+ *
+ * Blocks that were never used are handed out by bumping an index, released blocks are kept in a
+ * free list. Thus the pool is constant-initialized and doesn't need a startup loop to thread the
+ * free list, allocation and release are O(1).
+ *
+ * @tparam BlockSize Size of a single block, rounded up to the max alignment
+ * @tparam BlockCount Number of blocks in the pool
+ * @tparam Sync Synchronization, with `pool_sync::interrupt_mask` the operations mask interrupts
+ *              for a few instructions
+ */
+template <std::size_t BlockSize, std::size_t BlockCount, pool_sync Sync = pool_sync::none>
+class fixed_pool {
+public:
+    static constexpr std::size_t alignment = pool_alignment;
+    static constexpr std::size_t block_size
+        = (BlockSize + alignment - 1) / alignment * alignment;
+    static constexpr std::size_t block_count = BlockCount;
+    static constexpr pool_sync   sync        = Sync;
+
+    static_assert(block_size > 0, "Pool block size must not be zero");
+    static_assert(block_count > 0, "Pool must contain at least one block");
+
+public:
+    constexpr fixed_pool() noexcept = default;
+
+    fixed_pool(fixed_pool const&) = delete;
+    fixed_pool(fixed_pool&&)      = delete;
+
+    fixed_pool&
+    operator=(fixed_pool const&)
+        = delete;
+    fixed_pool&
+    operator=(fixed_pool&&)
+        = delete;
+
+    /**
+     * @brief Allocate a block
+     * @param size Requested size, must not exceed block_size
+     * @return Pointer to the block or nullptr if the pool is exhausted or the size is too big
+     */
+    void*
+    allocate(std::size_t size) noexcept
+    {
+        detail::pool_lock<sync> lock;
+        if (size > block_size) {
+            ++failures_;
+            return nullptr;
+        }
+
+        block* result = free_;
+        if (result) {
+            free_ = result->next;
+        } else if (used_ < block_count) {
+            result = &blocks_[used_++];
+        } else {
+            ++failures_;
+            return nullptr;
+        }
+        ++allocations_;
+        ++in_use_;
+        if (in_use_ > high_water_)
+            high_water_ = in_use_;
+        return result->storage;
+    }
+
+    /**
+     * @brief Return a block to the pool
+     * @param ptr Pointer previously returned by allocate
+     */
+    void
+    deallocate(void* ptr) noexcept
+    {
+        if (!ptr)
+            return;
+
+        detail::pool_lock<sync> lock;
+        auto                    blk = static_cast<block*>(ptr);
+        blk->next                   = free_;
+        free_                       = blk;
+        --in_use_;
+    }
+
+    /**
+     * @brief Check if a pointer belongs to the pool
+     */
+    bool
+    owns(void const* ptr) const noexcept
+    {
+        auto p = static_cast<std::byte const*>(ptr);
+        return p >= blocks_[0].storage && p < blocks_[block_count - 1].storage + block_size;
+    }
+
+    /**
+     * @brief Number of blocks currently allocated
+     */
+    std::size_t
+    in_use() const noexcept
+    {
+        return in_use_;
+    }
+
+    /**
+     * @brief Maximum number of blocks allocated simultaneously
+     */
+    std::size_t
+    high_water_mark() const noexcept
+    {
+        return high_water_;
+    }
+
+    /**
+     * @brief Number of failed allocations
+     */
+    std::size_t
+    failures() const noexcept
+    {
+        return failures_;
+    }
+
+    pool_stats
+    stats() const noexcept
+    {
+        return {block_size, block_count, in_use_, high_water_, allocations_, failures_};
+    }
+
+private:
+    union block {
+        block*                       next;
+        alignas(alignment) std::byte storage[block_size];
+    };
+
+    block       blocks_[block_count]{};
+    block*      free_        = nullptr;
+    std::size_t used_        = 0;
+    std::size_t in_use_      = 0;
+    std::size_t high_water_  = 0;
+    std::size_t allocations_ = 0;
+    std::size_t failures_    = 0;
+};
+
+namespace detail {
+
+template <pool_class... Classes>
+constexpr bool
+pool_classes_sorted()
+{
+    std::size_t sizes[]{Classes.block_size...};
+    for (std::size_t i = 1; i < sizeof...(Classes); ++i) {
+        if (sizes[i - 1] >= sizes[i])
+            return false;
+    }
+    return true;
+}
+
+}    // namespace detail
+
+/**
+ * @class pool_allocator
+ * @brief Size-class allocator over fixed block pools
+ *
+ * A request is served by the smallest class with blocks large enough, when the class is exhausted
+ * the next larger classes are tried. Requests larger than the largest class and requests no class
+ * can serve fail, nothing falls back to the heap. The number of classes is a compile-time
+ * constant, so allocation and release take a bounded number of steps, and the pools don't
+ * fragment.
+ *
+ * ```c++
+ * constinit util::pool_allocator<util::pool_sync::interrupt_mask,
+ *                                util::pool_class{32, 16}, util::pool_class{128, 4}> pool;
+ *
+ * void* buffer = pool.allocate(100);
+ * pool.deallocate(buffer);
+ * ```
+ *
+ * @tparam Sync    Synchronization of the operations
+ * @tparam Classes Size classes, ordered by the block size
+ */
+template <pool_sync Sync, pool_class... Classes>
+class pool_allocator {
+    static_assert(sizeof...(Classes) > 0, "A pool allocator needs at least one size class");
+    static_assert(detail::pool_classes_sorted<Classes...>(),
+                  "Pool size classes must be ordered by the block size, without duplicates");
+
+public:
+    static constexpr pool_sync   sync        = Sync;
+    static constexpr std::size_t class_count = sizeof...(Classes);
+    static constexpr std::size_t max_size
+        = std::max({fixed_pool<Classes.block_size, Classes.block_count>::block_size...});
+
+    using lock_type = detail::pool_lock<sync>;
+
+public:
+    constexpr pool_allocator() noexcept = default;
+
+    pool_allocator(pool_allocator const&) = delete;
+    pool_allocator(pool_allocator&&)      = delete;
+
+    pool_allocator&
+    operator=(pool_allocator const&)
+        = delete;
+    pool_allocator&
+    operator=(pool_allocator&&)
+        = delete;
+
+    /**
+     * @brief Allocate a block of at least `size` bytes, aligned to `pool_alignment`
+     * @return The block, nullptr if no class can serve the request
+     */
+    void*
+    allocate(std::size_t size) noexcept
+    {
+        lock_type lock;
+        void*     ptr = nullptr;
+        if (size > max_size) {
+            ++oversize_;
+            return ptr;
+        }
+        std::apply(
+            [&](auto&... pool) {
+                ((size <= pool.block_size && (ptr = pool.allocate(size)) != nullptr) || ...);
+            },
+            pools_);
+        return ptr;
+    }
+
+    /**
+     * @brief Return a block to its class
+     * @return false if the block was not allocated from this allocator
+     */
+    bool
+    deallocate(void* ptr) noexcept
+    {
+        if (ptr == nullptr)
+            return true;
+        lock_type lock;
+        return std::apply(
+            [&](auto&... pool) {
+                return ((pool.owns(ptr) && (pool.deallocate(ptr), true)) || ...);
+            },
+            pools_);
+    }
+
+    /**
+     * @brief Check if a pointer points into the storage of the allocator
+     */
+    bool
+    owns(void const* ptr) const noexcept
+    {
+        return std::apply([&](auto const&... pool) { return (pool.owns(ptr) || ...); }, pools_);
+    }
+
+    /**
+     * @brief Counters of a size class
+     * @param index Index of the class, in the template argument order
+     */
+    pool_stats
+    stats(std::size_t index) const noexcept
+    {
+        lock_type  lock;
+        pool_stats result{};
+        std::apply(
+            [&](auto const&... pool) {
+                std::size_t i = 0;
+                ((i++ == index && (result = pool.stats(), true)) || ...);
+            },
+            pools_);
+        return result;
+    }
+
+    /**
+     * @brief Number of requests larger than the largest class
+     */
+    std::size_t
+    oversize_failures() const noexcept
+    {
+        return oversize_;
+    }
+
+private:
+    std::tuple<fixed_pool<Classes.block_size, Classes.block_count>...> pools_;
+    std::size_t                                                        oversize_ = 0;
+};
+
+}    // namespace armpp::util
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <armpp/util/pool_allocator.hpp>
+
+/**
+ * @brief Size classes of the global `operator new` pools
+ *
+ * Override with a compile definition listing `armpp::util::pool_class{size, count}` values ordered
+ * by the block size. The default takes 2 KiB of RAM.
+ */
+#ifndef ARMPP_POOL_NEW_CLASSES
+#    define ARMPP_POOL_NEW_CLASSES                                                                 \
+        armpp::util::pool_class{16, 32}, armpp::util::pool_class{32, 16},                          \
+            armpp::util::pool_class{64, 8}, armpp::util::pool_class{128, 4}
+#endif
+
+namespace armpp::util {
+
+/**
+ * @brief Allocator behind the global `operator new` and `operator delete`
+ *
+ * Built with `ARMPP_POOL_NEW=ON` the library replaces the global allocation functions, all dynamic
+ * allocations (`std::function` targets, `new` expressions, standard containers) are served from
+ * fixed block pools instead of the libc heap. The pools mask the interrupts, so the operators can
+ * be used from handlers.
+ *
+ * A failed allocation calls the new handler if one is installed and retries, without one the
+ * throwing forms trap, the `std::nothrow` forms return nullptr. The counters of the classes show
+ * which class to enlarge.
+ */
+using global_pool_type = pool_allocator<pool_sync::interrupt_mask, ARMPP_POOL_NEW_CLASSES>;
+
+/**
+ * @brief The global allocator, to read the statistics
+ */
+global_pool_type const&
+global_pool() noexcept;
+
+}    // namespace armpp::util
@@ -0,0 +1,202 @@
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+
+namespace armpp::util {
+
+/**
+ * @class ring_buffer
+ * @brief Fixed capacity FIFO buffer for one execution context
+ *
+ * Indexes run freely and are masked on access, so the capacity must be a power of two and all of
+ * the slots are usable. Besides element and batch copies, the buffer hands out the contiguous
+ * free and filled regions as spans, so a driver can fill it from a peripheral FIFO or drain it to
+ * a write call without an intermediate copy:
+ *
+ * ```c++
+ * auto space = tx_buffer.write_span();
+ * auto count = format(space);
+ * tx_buffer.commit(count);
+ * // ...
+ * auto data = tx_buffer.read_span();
+ * auto sent = port.write(data);
+ * tx_buffer.consume(sent);
+ * ```
+ *
+ * The buffer is not synchronized, for passing data between a handler and thread mode use
+ * `spsc_queue`.
+ *
+ * @tparam T Element type
+ * @tparam Capacity Number of elements, power of two
+ */
+template <typename T, std::size_t Capacity>
+    requires std::default_initializable<T> && std::movable<T>
+class ring_buffer {
+public:
+    using value_type = T;
+    using index_type = std::uint32_t;
+
+    static constexpr std::size_t capacity = Capacity;
+    static_assert(capacity > 0 && (capacity & (capacity - 1)) == 0,
+                  "Ring buffer capacity must be a power of two");
+
+public:
+    constexpr ring_buffer() noexcept = default;
+
+    //@{
+    /** @name Size */
+    std::size_t
+    size() const noexcept
+    {
+        return tail_ - head_;
+    }
+
+    std::size_t
+    available() const noexcept
+    {
+        return capacity - size();
+    }
+
+    bool
+    empty() const noexcept
+    {
+        return tail_ == head_;
+    }
+
+    bool
+    full() const noexcept
+    {
+        return size() == capacity;
+    }
+    //@}
+
+    //@{
+    /** @name Writing */
+    /**
+     * @return false if the buffer is full
+     */
+    bool
+    push(value_type value)
+    {
+        if (full())
+            return false;
+        buffer_[tail_++ & mask] = std::move(value);
+        return true;
+    }
+
+    /**
+     * @brief Copy as many elements as fit
+     * @return Number of elements copied
+     */
+    std::size_t
+    push(std::span<value_type const> values)
+    {
+        auto count = std::min(values.size(), available());
+        auto first = std::min<std::size_t>(count, capacity - (tail_ & mask));
+        std::copy_n(values.begin(), first, buffer_ + (tail_ & mask));
+        std::copy_n(values.begin() + first, count - first, buffer_);
+        tail_ += static_cast<index_type>(count);
+        return count;
+    }
+
+    /**
+     * @brief Contiguous free region after the last element
+     *
+     * When the free space wraps around, only the part up to the end of the storage is returned,
+     * call again after the commit for the rest.
+     */
+    std::span<value_type>
+    write_span() noexcept
+    {
+        auto offset = tail_ & mask;
+        return {buffer_ + offset, std::min<std::size_t>(available(), capacity - offset)};
+    }
+
+    /**
+     * @brief Append the elements written to the front of `write_span()`
+     */
+    void
+    commit(std::size_t count) noexcept
+    {
+        tail_ += static_cast<index_type>(count);
+    }
+    //@}
+
+    //@{
+    /** @name Reading */
+    /**
+     * @return false if the buffer is empty
+     */
+    bool
+    pop(value_type& value)
+    {
+        if (empty())
+            return false;
+        value = std::move(buffer_[head_++ & mask]);
+        return true;
+    }
+
+    /**
+     * @brief Move out as many elements as available
+     * @return Number of elements moved
+     */
+    std::size_t
+    pop(std::span<value_type> values)
+    {
+        auto count = std::min(values.size(), size());
+        auto first = std::min<std::size_t>(count, capacity - (head_ & mask));
+        std::move(buffer_ + (head_ & mask), buffer_ + (head_ & mask) + first, values.begin());
+        std::move(buffer_, buffer_ + (count - first), values.begin() + first);
+        head_ += static_cast<index_type>(count);
+        return count;
+    }
+
+    value_type&
+    front() noexcept
+    {
+        return buffer_[head_ & mask];
+    }
+
+    /**
+     * @brief Contiguous region of the oldest elements
+     *
+     * When the elements wrap around, only the part up to the end of the storage is returned, call
+     * again after consuming it for the rest.
+     */
+    std::span<value_type const>
+    read_span() const noexcept
+    {
+        auto offset = head_ & mask;
+        return {buffer_ + offset, std::min<std::size_t>(size(), capacity - offset)};
+    }
+
+    /**
+     * @brief Drop the oldest elements, usually the ones read from `read_span()`
+     */
+    void
+    consume(std::size_t count) noexcept
+    {
+        head_ += static_cast<index_type>(count);
+    }
+
+    void
+    clear() noexcept
+    {
+        head_ = tail_;
+    }
+    //@}
+
+private:
+    static constexpr index_type mask = capacity - 1;
+
+    value_type buffer_[capacity]{};
+    index_type head_ = 0;
+    index_type tail_ = 0;
+};
+
+}    // namespace armpp::util
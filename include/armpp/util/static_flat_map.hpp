@@ -0,0 +1,213 @@
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <span>
+#include <utility>
+
+namespace armpp::util {
+
+/**
+ * @class static_flat_map
+ * @brief Sorted associative array with a fixed capacity
+ *
+ * Keys and values are kept in two sorted arrays, so the search touches only the keys. The lookup
+ * is a branchless binary search: the loop runs log2(size) times whatever the keys, each step is a
+ * compare and a conditional select, there are no mispredicted branches and the loop is the same
+ * on a core without a branch predictor. Insertion and removal move the elements after the
+ * position, the map is meant for tables filled once and searched often.
+ *
+ * Nothing is allocated, the map can be built at compile time:
+ *
+ * ```c++
+ * constexpr util::static_flat_map<std::uint32_t, char const*, 4> names{
+ *     {0x40004000, "uart0"}, {0x40005000, "uart1"}, {0x40000000, "timer0"}};
+ * static_assert(*names.find(0x40005000) == std::string_view{"uart1"});
+ * ```
+ *
+ * @tparam Key Key type
+ * @tparam Value Mapped type
+ * @tparam Capacity Maximum number of elements
+ * @tparam Compare Key ordering
+ */
+template <typename Key, typename Value, std::size_t Capacity, typename Compare = std::less<>>
+    requires std::default_initializable<Key> && std::default_initializable<Value>
+class static_flat_map {
+public:
+    using key_type    = Key;
+    using mapped_type = Value;
+    using size_type   = std::size_t;
+
+    static constexpr size_type capacity = Capacity;
+
+public:
+    constexpr static_flat_map() noexcept = default;
+
+    /**
+     * @brief Fill the map, the elements that don't fit and the duplicate keys are dropped
+     */
+    constexpr static_flat_map(std::initializer_list<std::pair<key_type, mapped_type>> init)
+    {
+        for (auto const& [key, value] : init) {
+            insert(key, value);
+        }
+    }
+
+    //@{
+    /** @name Size */
+    constexpr size_type
+    size() const noexcept
+    {
+        return size_;
+    }
+
+    constexpr bool
+    empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+    constexpr bool
+    full() const noexcept
+    {
+        return size_ == capacity;
+    }
+    //@}
+
+    //@{
+    /** @name Lookup */
+    /**
+     * @return Pointer to the value mapped to the key, nullptr if there is none
+     */
+    constexpr mapped_type*
+    find(key_type const& key) noexcept
+    {
+        auto index = lower_bound(key);
+        return index < size_ && !compare_(key, keys_[index]) ? &values_[index] : nullptr;
+    }
+
+    constexpr mapped_type const*
+    find(key_type const& key) const noexcept
+    {
+        auto index = lower_bound(key);
+        return index < size_ && !compare_(key, keys_[index]) ? &values_[index] : nullptr;
+    }
+
+    constexpr bool
+    contains(key_type const& key) const noexcept
+    {
+        return find(key) != nullptr;
+    }
+
+    /**
+     * @brief Index of the first key not less than `key`, `size()` if there is none
+     */
+    constexpr size_type
+    lower_bound(key_type const& key) const noexcept
+    {
+        if (size_ == 0)
+            return 0;
+        size_type base = 0;
+        size_type len  = size_;
+        while (len > 1) {
+            auto half = len / 2;
+            base      = compare_(keys_[base + half - 1], key) ? base + half : base;
+            len -= half;
+        }
+        return base + (compare_(keys_[base], key) ? 1 : 0);
+    }
+
+    /**
+     * @brief Keys in the ascending order
+     */
+    constexpr std::span<key_type const>
+    keys() const noexcept
+    {
+        return {keys_, size_};
+    }
+
+    /**
+     * @brief Values in the order of the keys
+     */
+    constexpr std::span<mapped_type>
+    values() noexcept
+    {
+        return {values_, size_};
+    }
+
+    constexpr std::span<mapped_type const>
+    values() const noexcept
+    {
+        return {values_, size_};
+    }
+    //@}
+
+    //@{
+    /** @name Modifiers */
+    /**
+     * @brief Insert a key if it isn't in the map
+     * @return Pointer to the value mapped to the key, nullptr if the key is new and the map is full
+     */
+    constexpr mapped_type*
+    insert(key_type const& key, mapped_type value)
+    {
+        auto index = lower_bound(key);
+        if (index < size_ && !compare_(key, keys_[index]))
+            return &values_[index];
+        if (full())
+            return nullptr;
+        std::move_backward(keys_ + index, keys_ + size_, keys_ + size_ + 1);
+        std::move_backward(values_ + index, values_ + size_, values_ + size_ + 1);
+        keys_[index]   = key;
+        values_[index] = std::move(value);
+        ++size_;
+        return &values_[index];
+    }
+
+    /**
+     * @brief Insert a key or replace its value
+     * @return Pointer to the value, nullptr if the key is new and the map is full
+     */
+    constexpr mapped_type*
+    insert_or_assign(key_type const& key, mapped_type value)
+    {
+        if (auto existing = find(key)) {
+            *existing = std::move(value);
+            return existing;
+        }
+        return insert(key, std::move(value));
+    }
+
+    /**
+     * @return false if the key is not in the map
+     */
+    constexpr bool
+    erase(key_type const& key)
+    {
+        auto index = lower_bound(key);
+        if (index == size_ || compare_(key, keys_[index]))
+            return false;
+        std::move(keys_ + index + 1, keys_ + size_, keys_ + index);
+        std::move(values_ + index + 1, values_ + size_, values_ + index);
+        --size_;
+        return true;
+    }
+
+    constexpr void
+    clear() noexcept
+    {
+        size_ = 0;
+    }
+    //@}
+
+private:
+    key_type                      keys_[capacity]{};
+    mapped_type                   values_[capacity]{};
+    size_type                     size_ = 0;
+    [[no_unique_address]] Compare compare_{};
+};
+
+}    // namespace armpp::util
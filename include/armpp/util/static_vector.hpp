@@ -0,0 +1,258 @@
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace armpp::util {
+
+/**
+ * @class static_vector
+ * @brief Vector with the storage for a fixed number of elements inside the object
+ *
+ * The elements are constructed in place when added and destroyed when removed, the storage is
+ * never allocated. There are no exceptions: adding to a full vector returns false (or nullptr)
+ * and leaves the vector unchanged.
+ *
+ * @tparam T Element type
+ * @tparam Capacity Maximum number of elements
+ */
+template <typename T, std::size_t Capacity>
+class static_vector {
+public:
+    using value_type      = T;
+    using size_type       = std::size_t;
+    using reference       = T&;
+    using const_reference = T const&;
+    using pointer         = T*;
+    using const_pointer   = T const*;
+    using iterator        = T*;
+    using const_iterator  = T const*;
+
+    static constexpr size_type capacity = Capacity;
+
+public:
+    static_vector() noexcept = default;
+
+    static_vector(std::initializer_list<value_type> init)
+        requires std::copy_constructible<value_type>
+    {
+        for (auto const& value : init) {
+            if (!push_back(value))
+                break;
+        }
+    }
+
+    static_vector(static_vector const& other)
+        requires std::copy_constructible<value_type>
+    {
+        std::uninitialized_copy(other.begin(), other.end(), data());
+        size_ = other.size_;
+    }
+
+    static_vector(static_vector&& other) noexcept(std::is_nothrow_move_constructible_v<value_type>)
+    {
+        std::uninitialized_move(other.begin(), other.end(), data());
+        size_ = other.size_;
+        other.clear();
+    }
+
+    ~static_vector() { clear(); }
+
+    static_vector&
+    operator=(static_vector const& other)
+        requires std::copy_constructible<value_type>
+    {
+        if (this != &other) {
+            clear();
+            std::uninitialized_copy(other.begin(), other.end(), data());
+            size_ = other.size_;
+        }
+        return *this;
+    }
+
+    static_vector&
+    operator=(static_vector&& other) noexcept(std::is_nothrow_move_constructible_v<value_type>)
+    {
+        if (this != &other) {
+            clear();
+            std::uninitialized_move(other.begin(), other.end(), data());
+            size_ = other.size_;
+            other.clear();
+        }
+        return *this;
+    }
+
+    //@{
+    /** @name Size */
+    size_type
+    size() const noexcept
+    {
+        return size_;
+    }
+
+    bool
+    empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+    bool
+    full() const noexcept
+    {
+        return size_ == capacity;
+    }
+    //@}
+
+    //@{
+    /** @name Element access */
+    pointer
+    data() noexcept
+    {
+        return std::launder(reinterpret_cast<pointer>(storage_));
+    }
+
+    const_pointer
+    data() const noexcept
+    {
+        return std::launder(reinterpret_cast<const_pointer>(storage_));
+    }
+
+    reference
+    operator[](size_type index) noexcept
+    {
+        return data()[index];
+    }
+
+    const_reference
+    operator[](size_type index) const noexcept
+    {
+        return data()[index];
+    }
+
+    reference
+    front() noexcept
+    {
+        return data()[0];
+    }
+
+    reference
+    back() noexcept
+    {
+        return data()[size_ - 1];
+    }
+
+    iterator
+    begin() noexcept
+    {
+        return data();
+    }
+
+    iterator
+    end() noexcept
+    {
+        return data() + size_;
+    }
+
+    const_iterator
+    begin() const noexcept
+    {
+        return data();
+    }
+
+    const_iterator
+    end() const noexcept
+    {
+        return data() + size_;
+    }
+
+    operator std::span<value_type>() noexcept { return {data(), size_}; }
+    operator std::span<value_type const>() const noexcept { return {data(), size_}; }
+    //@}
+
+    //@{
+    /** @name Modifiers */
+    /**
+     * @brief Construct an element at the end
+     * @return Pointer to the new element, nullptr if the vector is full
+     */
+    template <typename... Args>
+    pointer
+    emplace_back(Args&&... args)
+    {
+        if (full())
+            return nullptr;
+        auto ptr = std::construct_at(data() + size_, std::forward<Args>(args)...);
+        ++size_;
+        return ptr;
+    }
+
+    /**
+     * @return false if the vector is full
+     */
+    bool
+    push_back(value_type const& value)
+    {
+        return emplace_back(value) != nullptr;
+    }
+
+    /**
+     * @return false if the vector is full
+     */
+    bool
+    push_back(value_type&& value)
+    {
+        return emplace_back(std::move(value)) != nullptr;
+    }
+
+    void
+    pop_back() noexcept
+    {
+        std::destroy_at(data() + --size_);
+    }
+
+    /**
+     * @brief Remove an element, the following elements are moved to close the gap
+     * @return Iterator to the element after the removed one
+     */
+    iterator
+    erase(const_iterator pos)
+    {
+        auto first = begin() + (pos - begin());
+        std::move(first + 1, end(), first);
+        pop_back();
+        return first;
+    }
+
+    /**
+     * @brief Remove an element in O(1), the last element is moved in its place
+     */
+    void
+    erase_unordered(const_iterator pos)
+    {
+        auto target = begin() + (pos - begin());
+        if (target != end() - 1)
+            *target = std::move(back());
+        pop_back();
+    }
+
+    void
+    clear() noexcept
+    {
+        std::destroy(begin(), end());
+        size_ = 0;
+    }
+    //@}
+
+private:
+    alignas(value_type) std::byte storage_[sizeof(value_type) * capacity];
+    size_type size_ = 0;
+};
+
+}    // namespace armpp::util
@@ -1,11 +1,15 @@
 #pragma once
 
+#include <armpp/util/divide.hpp>
+
 #include <concepts>
 #include <cstdint>
+#include <limits>
+#include <type_traits>
 
 namespace armpp::util {
 
-inline void
+constexpr void
 reverse_string(char* first, char* last)
 {
     for (; first < last; ++first, --last) {
@@ -17,8 +21,15 @@ reverse_string(char* first, char* last)
 
 enum class number_base { bin = 2, oct = 8, dec = 10, hex = 16 };
 
+/**
+ * @brief Buffer size for any base with the default width, the binary digits with a space between
+ *        the bytes and the terminating zero
+ */
 template <std::integral Integer>
-void
+constexpr std::size_t to_chars_buffer_size = sizeof(Integer) * 8 + sizeof(Integer);
+
+template <std::integral Integer>
+constexpr void
 to_chars(char* buffer, std::size_t buffer_length, Integer value,
          number_base base = number_base::dec, std::int8_t width = 0, char fill = ' ')
 {
@@ -27,11 +38,15 @@ to_chars(char* buffer, std::size_t buffer_length, Integer value,
     constexpr char digit_chars[]
         = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
 
-    // TODO check buffer size
+    if (buffer_length == 0)
+        return;
     if (base == number_base::bin) {
-        if (width <= 0)
+        // Wider than the type would shift past its bits
+        if (width <= 0 || width > static_cast<int>(bit_count))
             width = bit_count;
-        while (width > 0) {
+        // The digits that don't fit are dropped, the zero always does
+        auto last = buffer + buffer_length - 1;
+        while (width > 0 && buffer < last) {
             switch ((value >> (width - 1) & 1)) {
             case 0:
                 *buffer++ = '0';
@@ -41,32 +56,52 @@ to_chars(char* buffer, std::size_t buffer_length, Integer value,
                 break;
             }
             --width;
-            if (width % 8 == 0 && width != 0) {
+            if (width % 8 == 0 && width != 0 && buffer < last) {
                 *buffer++ = ' ';
             }
         }
         *buffer++ = 0;
     } else {
-        auto sign = false;
+        using unsigned_type = std::make_unsigned_t<Integer>;
+        auto sign           = false;
+        auto magnitude      = static_cast<unsigned_type>(value);
         if constexpr (std::is_signed_v<Integer>) {
             if (base == number_base::dec) {
-                sign = value & (1 << (bit_count - 1));
+                // Negated in the unsigned type, the minimum of the type has no positive counterpart
+                sign = value < 0;
                 if (sign)
-                    value = -value;
+                    magnitude = static_cast<unsigned_type>(unsigned_type{0} - magnitude);
             } else {
-                to_chars(buffer, buffer_length, static_cast<std::make_unsigned_t<Integer>>(value),
-                         base, width, fill);
+                to_chars(buffer, buffer_length, magnitude, base, width, fill);
                 return;
             }
         }
         auto current = buffer;
-        if (value == 0) {
+        if (magnitude == 0) {
             *current++ = '0';
         } else {
             auto base_value = static_cast<std::underlying_type_t<number_base>>(base);
-            while (value > 0) {
-                *current++ = digit_chars[value % base_value];
-                value /= base_value;
+            if (base != number_base::dec) {
+                // Power of two bases, no division at all
+                auto shift = base == number_base::hex ? 4 : 3;
+                auto mask  = static_cast<unsigned_type>(base_value - 1);
+                while (magnitude > 0) {
+                    *current++ = digit_chars[magnitude & mask];
+                    magnitude >>= shift;
+                }
+            } else if constexpr (sizeof(Integer) <= sizeof(std::uint32_t)) {
+                // Cores without a divider get a division free sequence
+                auto rest = static_cast<std::uint32_t>(magnitude);
+                while (rest > 0) {
+                    auto [quot, rem] = divmod10(rest);
+                    *current++       = digit_chars[rem];
+                    rest             = quot;
+                }
+            } else {
+                while (magnitude > 0) {
+                    *current++ = digit_chars[magnitude % base_value];
+                    magnitude /= base_value;
+                }
             }
         }
         if (sign) {
@@ -82,6 +117,50 @@ to_chars(char* buffer, std::size_t buffer_length, Integer value,
     }
 }
 
+namespace detail {
+
+template <std::integral Integer>
+constexpr bool
+to_chars_equals(Integer value, char const* expected)
+{
+    char buffer[sizeof(Integer) * 8 + 1]{};
+    to_chars(buffer, sizeof(buffer), value);
+    auto i = 0u;
+    for (; expected[i] != 0; ++i) {
+        if (buffer[i] != expected[i])
+            return false;
+    }
+    return buffer[i] == 0;
+}
+
+}    // namespace detail
+
+// The minimum of a signed type is negated in the unsigned type and fits the bit_count + 1 buffer
+static_assert(detail::to_chars_equals(std::int8_t{-128}, "-128"));
+static_assert(detail::to_chars_equals(std::int16_t{-32768}, "-32768"));
+static_assert(detail::to_chars_equals(std::numeric_limits<std::int32_t>::min(), "-2147483648"));
+static_assert(detail::to_chars_equals(std::numeric_limits<std::int64_t>::min(),
+                                      "-9223372036854775808"));
+static_assert(detail::to_chars_equals(std::int8_t{-1}, "-1"));
+static_assert(detail::to_chars_equals(std::uint8_t{255}, "255"));
+
+namespace detail {
+
+constexpr bool
+to_chars_bin_fits()
+{
+    char buffer[to_chars_buffer_size<std::uint32_t>]{};
+    to_chars(buffer, sizeof(buffer), std::uint32_t{1}, number_base::bin);
+    char truncated[4]{'x', 'x', 'x', 'x'};
+    to_chars(truncated, sizeof(truncated), std::uint32_t{0xff}, number_base::bin);
+    return buffer[sizeof(buffer) - 2] == '1' && buffer[sizeof(buffer) - 1] == 0
+        && buffer[8] == ' ' && truncated[3] == 0;
+}
+
+}    // namespace detail
+
+static_assert(detail::to_chars_bin_fits());
+
 template <typename T>
 void
 to_chars(char* buffer, std::size_t buffer_length, T* pointer)
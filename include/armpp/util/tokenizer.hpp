@@ -0,0 +1,198 @@
+#pragma once
+
+#include <armpp/util/from_chars.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+namespace armpp::util {
+
+/**
+ * @class tokenizer
+ * @brief Splits a line into whitespace separated tokens without copying
+ *
+ * The tokens are views into the input, which must outlive them. A token in double quotes may
+ * contain whitespace, the quotes are not part of it and there are no escapes. The input is
+ * usually a span handed out by the RX ring buffer:
+ *
+ * ```c++
+ * util::tokenizer tokens{rx_buffer.read_span()};
+ * auto command = tokens.next();
+ * std::uint32_t address;
+ * if (!tokens.next(address, number_base::hex)) {
+ *     // ...
+ * }
+ * ```
+ */
+class tokenizer {
+public:
+    class iterator;
+
+public:
+    constexpr explicit tokenizer(std::string_view input) noexcept : rest_{input} {}
+    template <typename Char, std::size_t Extent>
+        requires std::same_as<std::remove_const_t<Char>, char>
+    constexpr explicit tokenizer(std::span<Char, Extent> input) noexcept
+        : rest_{input.data(), input.size()}
+    {}
+
+    /**
+     * @brief The next token, an empty view at the end of the input
+     */
+    constexpr std::string_view
+    next() noexcept
+    {
+        skip_space();
+        if (rest_.empty())
+            return {};
+        std::size_t end;
+        std::size_t skip;
+        if (rest_.front() == '"') {
+            rest_.remove_prefix(1);
+            end  = rest_.find('"');
+            skip = end == std::string_view::npos ? end : end + 1;
+        } else {
+            end = 0;
+            while (end < rest_.size() && !is_space(rest_[end]))
+                ++end;
+            skip = end;
+        }
+        auto token = rest_.substr(0, end);
+        rest_.remove_prefix(skip < rest_.size() ? skip : rest_.size());
+        return token;
+    }
+
+    /**
+     * @brief Parse the next token as an integer
+     * @return True if there is a token and it is a number in the base, the token is consumed
+     *         either way
+     */
+    template <std::integral Integer>
+    constexpr bool
+    next(Integer& value, number_base base = number_base::dec) noexcept
+    {
+        auto token = next();
+        return !token.empty() && util::from_chars(token, value, base);
+    }
+
+    /**
+     * @brief The unparsed part of the input, without the leading whitespace
+     */
+    constexpr std::string_view
+    rest() noexcept
+    {
+        skip_space();
+        return rest_;
+    }
+
+    constexpr bool
+    empty() noexcept
+    {
+        return rest().empty();
+    }
+
+    constexpr iterator
+    begin() noexcept;
+    constexpr std::default_sentinel_t
+    end() const noexcept
+    {
+        return {};
+    }
+
+private:
+    static constexpr bool
+    is_space(char c) noexcept
+    {
+        return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+    }
+
+    constexpr void
+    skip_space() noexcept
+    {
+        std::size_t count = 0;
+        while (count < rest_.size() && is_space(rest_[count]))
+            ++count;
+        rest_.remove_prefix(count);
+    }
+
+private:
+    std::string_view rest_;
+};
+
+/**
+ * @brief Input iterator over the remaining tokens, advancing it consumes the token
+ */
+class tokenizer::iterator {
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type        = std::string_view;
+    using difference_type   = std::ptrdiff_t;
+
+    constexpr iterator() noexcept = default;
+    constexpr explicit iterator(tokenizer& tokens) noexcept : tokens_{&tokens}, token_{tokens.next()}
+    {}
+
+    constexpr value_type
+    operator*() const noexcept
+    {
+        return token_;
+    }
+
+    constexpr iterator&
+    operator++() noexcept
+    {
+        token_ = tokens_->next();
+        return *this;
+    }
+
+    constexpr void
+    operator++(int) noexcept
+    {
+        ++*this;
+    }
+
+    constexpr bool
+    operator==(std::default_sentinel_t) const noexcept
+    {
+        // An empty quoted token ends the iteration as well
+        return token_.empty();
+    }
+
+private:
+    tokenizer*       tokens_ = nullptr;
+    std::string_view token_;
+};
+
+constexpr tokenizer::iterator
+tokenizer::begin() noexcept
+{
+    return iterator{*this};
+}
+
+static_assert([] {
+    tokenizer tokens{"  set  \"a b\"\t0x10 42\r\n"};
+    return tokens.next() == "set" && tokens.next() == "a b" && tokens.rest() == "0x10 42\r\n";
+}());
+
+static_assert([] {
+    tokenizer     tokens{"baud 115200 ff"};
+    std::uint32_t baud = 0;
+    std::uint8_t  mask = 0;
+    return tokens.next() == "baud" && tokens.next(baud) && baud == 115200
+        && tokens.next(mask, number_base::hex) && mask == 0xff && tokens.empty();
+}());
+
+static_assert([] {
+    tokenizer   tokens{"a bb ccc"};
+    std::size_t length = 0;
+    for (auto token : tokens) {
+        length += token.size();
+    }
+    return length == 6;
+}());
+
+}    // namespace armpp::util
@@ -45,6 +45,18 @@ public:
 template <typename Period1, typename Period2>
 using common_ratio_t = typename common_ratio<Period1, Period2>::type;
 
+/**
+ * @brief Class and member types of a pointer to data member
+ */
+template <typename T>
+struct member_pointer;
+
+template <typename Class, typename Member>
+struct member_pointer<Member Class::*> {
+    using class_type  = Class;
+    using member_type = Member;
+};
+
 static_assert(static_gcd<100, 1000>::value == 100);
 static_assert(std::is_same_v<common_ratio_t<std::kilo, std::mega>, std::kilo>);
 
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace armpp::util {
+
+/**
+ * @brief Maximum size of an unsigned LEB128 number of a type
+ */
+template <std::integral T>
+constexpr std::size_t max_varint_size
+    = (std::numeric_limits<std::make_unsigned_t<T>>::digits + 6) / 7;
+
+/**
+ * @brief Map a signed value to an unsigned one with the small magnitudes small, 0, -1, 1, -2...
+ *        become 0, 1, 2, 3...
+ */
+template <std::signed_integral T>
+constexpr std::make_unsigned_t<T>
+zigzag_encode(T value) noexcept
+{
+    using unsigned_type = std::make_unsigned_t<T>;
+    constexpr auto sign = std::numeric_limits<T>::digits;
+    return static_cast<unsigned_type>(static_cast<unsigned_type>(value) << 1)
+         ^ static_cast<unsigned_type>(value >> sign);
+}
+
+template <std::unsigned_integral T>
+constexpr std::make_signed_t<T>
+zigzag_decode(T value) noexcept
+{
+    return static_cast<std::make_signed_t<T>>((value >> 1) ^ (T{0} - (value & 1)));
+}
+
+/**
+ * @brief Write an unsigned LEB128 number, seven bits per byte, the lowest first
+ * @param out Buffer of at least `max_varint_size<T>` bytes
+ * @return Pointer past the last byte written
+ */
+template <std::unsigned_integral T>
+constexpr char*
+encode_varint(T value, char* out) noexcept
+{
+    // Most telemetry values fit into one or two bytes, the loop runs once per byte
+    while (value >= 0x80) {
+        *out++ = static_cast<char>(value | 0x80);
+        value >>= 7;
+    }
+    *out++ = static_cast<char>(value);
+    return out;
+}
+
+/**
+ * @brief Read an unsigned LEB128 number
+ * @return Pointer past the number, nullptr if the input ends inside it or the number doesn't fit
+ */
+template <std::unsigned_integral T>
+constexpr char const*
+decode_varint(char const* first, char const* last, T& value) noexcept
+{
+    constexpr unsigned digits = std::numeric_limits<T>::digits;
+
+    T        result = 0;
+    unsigned shift  = 0;
+    for (; first != last; shift += 7) {
+        auto byte = static_cast<unsigned char>(*first++);
+        auto bits = static_cast<T>(byte & 0x7f);
+        if (shift >= digits || (shift + 7 > digits && (bits >> (digits - shift)) != 0))
+            return nullptr;
+        result |= static_cast<T>(bits << shift);
+        if (!(byte & 0x80)) {
+            value = result;
+            return first;
+        }
+    }
+    return nullptr;
+}
+
+namespace detail {
+
+template <std::unsigned_integral T>
+constexpr bool
+varint_round_trip(T value, std::size_t size)
+{
+    char buffer[max_varint_size<T>]{};
+    auto end = encode_varint(value, buffer);
+    T    decoded{};
+    return end - buffer == static_cast<std::ptrdiff_t>(size)
+        && decode_varint(buffer, end, decoded) == end && decoded == value;
+}
+
+static_assert(varint_round_trip<std::uint32_t>(0, 1));
+static_assert(varint_round_trip<std::uint32_t>(127, 1));
+static_assert(varint_round_trip<std::uint32_t>(128, 2));
+static_assert(varint_round_trip<std::uint32_t>(0xffffffffu, 5));
+static_assert(varint_round_trip<std::uint8_t>(0xff, 2));
+static_assert(varint_round_trip<std::uint64_t>(~std::uint64_t{0}, 10));
+static_assert(zigzag_encode(0) == 0u && zigzag_encode(-1) == 1u && zigzag_encode(1) == 2u);
+static_assert(zigzag_encode(std::int8_t{-128}) == 255u);
+static_assert(zigzag_decode(zigzag_encode(-12345)) == -12345);
+static_assert([] {
+    // 0x100 doesn't fit into a byte
+    char const    bytes[] = {'\x80', '\x02'};
+    std::uint8_t  value   = 0;
+    return decode_varint(bytes, bytes + 2, value) == nullptr;
+}());
+
+}    // namespace detail
+
+}    // namespace armpp::util
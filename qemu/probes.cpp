@@ -0,0 +1,285 @@
+/**
+ * Probe firmware for the QEMU runner
+ *
+ * Every probe runs a HAL path `repetitions` times and sums the SysTick cycles, and the DWT cycles
+ * when the core implements the counter, spent in it. The results are printed to the console UART
+ * one line per probe:
+ *
+ *     probe <name> reps <count> ticks <systick cycles> cycles <dwt cycles>
+ *
+ * The `empty` probe measures the measurement itself, `tools/qemu_report.py` subtracts it from the
+ * other probes. With `-icount` QEMU executes one instruction per 2^shift ns of virtual time, the
+ * SysTick cycles are converted back to instruction counts.
+ *
+ * The kernel context switch probe runs last, main hands the CPU to the kernel and a kernel thread
+ * reports the result and ends the run. Its count is the number of switches.
+ */
+#include "board.hpp"
+//
+#include <armpp/hal/cpu.hpp>
+#include <armpp/hal/dwt.hpp>
+#include <armpp/hal/nvic.hpp>
+#include <armpp/hal/systick.hpp>
+#include <armpp/hal/timer.hpp>
+#include <armpp/hal/uart_io.hpp>
+#include <armpp/kernel/kernel.hpp>
+#include <armpp/util/lzss.hpp>
+#include <armpp/util/message_queue.hpp>
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace {
+
+using namespace armpp;
+using namespace armpp::hal;
+
+constexpr std::uint32_t repetitions  = 64;
+constexpr std::uint32_t systick_mask = 0x00ffffff;
+
+constexpr uart::uart_init console_init{
+    .enable                   = {.tx = true, .rx = false},
+    .enable_interrupt         = {.tx = false, .rx = false},
+    .enable_overrun_interrupt = {.tx = false, .rx = false},
+    .baud_rate                = 115200,
+    .enable_hs_test_mode      = false,
+};
+
+struct sample {
+    std::uint32_t ticks;
+    std::uint32_t cycles;
+};
+
+struct totals {
+    std::uint64_t ticks  = 0;
+    std::uint64_t cycles = 0;
+
+    void
+    add(sample const& start, sample const& end)
+    {
+        // SysTick counts down, DWT counts up
+        ticks += (start.ticks - end.ticks) & systick_mask;
+        cycles += end.cycles - start.cycles;
+    }
+};
+
+sample volatile irq_sample{};
+
+[[gnu::always_inline]] inline sample
+now()
+{
+    cpu::instruction_sync_barrier();
+    return {systick::systick_handle{}->current_value(), dwt::dwt_handle{}->cycles()};
+}
+
+template <typename Probe>
+totals
+measure(Probe&& probe)
+{
+    totals result;
+    for (std::uint32_t i = 0; i < repetitions; ++i) {
+        auto start = now();
+        probe();
+        auto end = now();
+        result.add(start, end);
+    }
+    return result;
+}
+
+void
+report(uart::uart_handle& console, char const* name, totals const& result,
+       std::uint32_t reps = repetitions)
+{
+    console << "probe " << name << " reps " << reps << " ticks " << result.ticks << " cycles "
+            << result.cycles << "\r\n";
+}
+
+/**
+ * Report the result to the semihosting host, QEMU exits with the status
+ */
+[[noreturn]] void
+semihosting_exit(bool success)
+{
+    // SYS_EXIT, ADP_Stopped_ApplicationExit or ADP_Stopped_RunTimeErrorUnknown
+    std::uint32_t reason = success ? 0x20026 : 0x20023;
+    asm volatile(
+        "   movs    r0, #0x18               \n"
+        "   mov     r1, %[reason]           \n"
+        "   bkpt    0xab                    \n"
+        :
+        : [reason] "r"(reason)
+        : "r0", "r1", "memory");
+    while (true)
+        ;
+}
+
+constexpr std::size_t kernel_stack_words = 512;
+
+constinit kernel::thread<kernel_stack_words> ping_thread;
+constinit kernel::thread<kernel_stack_words> pong_thread;
+
+void
+pong(void*)
+{
+    while (true) {
+        kernel::yield();
+    }
+}
+
+/**
+ * Context switch between two threads of the same priority yielding to each other. Runs after main
+ * handed the CPU to the kernel, so it also ends the run.
+ */
+[[noreturn]] void
+ping(void* arg)
+{
+    auto&  console  = *static_cast<uart::uart_handle*>(arg);
+    auto   switches = kernel::switch_count();
+    totals result;
+    for (std::uint32_t i = 0; i < repetitions; ++i) {
+        // The yield window holds two switches, to pong and back, and one measurement. The empty
+        // window adds the second measurement, so the report subtracts exactly one per switch.
+        auto start = now();
+        kernel::yield();
+        auto end = now();
+        result.add(start, end);
+        auto empty_start = now();
+        auto empty_end   = now();
+        result.add(empty_start, empty_end);
+    }
+    report(console, "kernel_context_switch", result, kernel::switch_count() - switches);
+
+    console << "done\r\n";
+    semihosting_exit(true);
+}
+
+}    // namespace
+
+extern "C" void
+probe_irq_handler()
+{
+    auto stamp        = now();
+    irq_sample.ticks  = stamp.ticks;
+    irq_sample.cycles = stamp.cycles;
+}
+
+extern "C" [[noreturn]] void
+probe_fault_handler()
+{
+    semihosting_exit(false);
+}
+
+int
+main()
+{
+    // Free running SysTick at the core clock, the tick interrupt would disturb the probes
+    systick::systick_handle systick;
+    systick->disable();
+    systick->handler_disable();
+    systick->set_source(systick::clock_source_t::core_clock);
+    systick->set_reload_value(systick_mask);
+    systick->enable();
+
+    uart::uart_handle   console{qemu::board::console::base_address, console_init};
+    uart::uart_handle   traffic{qemu::board::traffic::base_address, console_init};
+    timer::timer_handle timer{qemu::board::timer::base_address};
+    nvic::nvic_handle   nvic;
+
+    console << uart::dec_out << "armpp qemu probes\r\n";
+
+    report(console, "empty", measure([] {}));
+
+    // Interrupt entry: from the pending bit write to the first handler instruction, and back
+    nvic->set_irq_priority(qemu::board::free_irq, 0);
+    nvic->enable_irq(qemu::board::free_irq);
+    cpu::enable_interrupts();
+    {
+        totals entry;
+        totals round_trip;
+        for (std::uint32_t i = 0; i < repetitions; ++i) {
+            auto start = now();
+            nvic->set_pending(qemu::board::free_irq);
+            cpu::data_sync_barrier();
+            cpu::instruction_sync_barrier();
+            auto end = now();
+            entry.add(start, {irq_sample.ticks, irq_sample.cycles});
+            round_trip.add(start, end);
+        }
+        report(console, "isr_entry", entry);
+        report(console, "isr_round_trip", round_trip);
+    }
+    nvic->disable_irq(qemu::board::free_irq);
+
+    report(console, "uart_put", measure([&] { traffic->put('x'); }));
+    report(console, "uart_write_16", measure([&] { traffic << "0123456789abcdef"; }));
+    report(console, "uart_write_uint", measure([&] { traffic << 1234567890u; }));
+
+    // A 32 byte telemetry line into an encoder whose window holds the previous lines, the cycles
+    // per byte are the probe cycles over 32
+    {
+        static util::lzss_encoder<> lzss;
+        constexpr std::string_view  line{"I: adc ch1 3312 mV temp 231 C\r\n "};
+        std::uint32_t volatile      lzss_sink = 0;
+        auto out = [&](char c) { lzss_sink = static_cast<unsigned char>(c); };
+        lzss.write(line, out);
+        report(console, "lzss_encode_32", measure([&] { lzss.write(line, out); }));
+    }
+
+    // Queue throughput from thread mode, a push and a pop of one element, and of a batch of 16,
+    // the cycles per element are the batch probe cycles over 16
+    {
+        static util::spsc_queue<std::uint32_t, 64> spsc;
+        static util::mpsc_queue<std::uint32_t, 64> mpsc;
+        std::array<std::uint32_t, 16>              batch_in{};
+        std::array<std::uint32_t, 16>              batch_out{};
+        std::uint32_t volatile                     queue_sink = 0;
+
+        report(console, "spsc_push_pop", measure([&] {
+                   std::uint32_t value = 0;
+                   spsc.push(queue_sink);
+                   spsc.pop(value);
+                   queue_sink = value;
+               }));
+        report(console, "spsc_push_pop_16", measure([&] {
+                   spsc.push(std::span<std::uint32_t const>{batch_in});
+                   queue_sink = static_cast<std::uint32_t>(
+                       spsc.pop(std::span<std::uint32_t>{batch_out}));
+               }));
+        report(console, "mpsc_push_pop", measure([&] {
+                   std::uint32_t value = 0;
+                   mpsc.push(queue_sink);
+                   mpsc.pop(value);
+                   queue_sink = value;
+               }));
+        report(console, "mpsc_push_pop_16", measure([&] {
+                   mpsc.push(std::span<std::uint32_t const>{batch_in});
+                   queue_sink = static_cast<std::uint32_t>(
+                       mpsc.pop(std::span<std::uint32_t>{batch_out}));
+               }));
+    }
+
+    report(console, "timer_delay_1", measure([&] { timer.delay(1); }));
+    report(console, "timer_delay_100", measure([&] { timer.delay(100); }));
+
+    report(console, "nvic_enable_irq", measure([&] { nvic->enable_irq(qemu::board::free_irq); }));
+    report(console, "nvic_disable_irq",
+           measure([&] { nvic->disable_irq(qemu::board::free_irq); }));
+    report(console, "nvic_irq_enabled", measure([&] {
+               auto volatile enabled = nvic->irq_enabled(qemu::board::free_irq);
+               static_cast<void>(enabled);
+           }));
+    report(console, "nvic_set_clear_pending", measure([&] {
+               nvic->set_pending(qemu::board::free_irq);
+               nvic->clear_pending(qemu::board::free_irq);
+           }));
+    report(console, "nvic_set_priority",
+           measure([&] { nvic->set_irq_priority(qemu::board::free_irq, 0x40); }));
+
+    // The kernel runs last, it never returns to main. The console lives on, the interrupts use
+    // the main stack below this frame.
+    ping_thread.start(ping, &console, 1);
+    pong_thread.start(pong, nullptr, 1);
+    kernel::start();
+}
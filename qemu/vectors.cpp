@@ -0,0 +1,66 @@
+#include "board.hpp"
+//
+#include <armpp/hal/startup.hpp>
+#include <armpp/hal/system.hpp>
+#include <armpp/kernel/kernel.hpp>
+
+#include <array>
+#include <cstdint>
+
+// Defined by the linker script
+extern "C" std::uint32_t _estack[];
+
+extern "C" void
+probe_irq_handler();
+extern "C" [[noreturn]] void
+probe_fault_handler();
+
+namespace {
+
+using vector = void (*)();
+
+void
+default_handler()
+{
+    probe_fault_handler();
+}
+
+using descriptor = armpp::qemu::board::descriptor;
+
+constexpr std::array<vector, descriptor::irq_count>
+make_irq_vectors()
+{
+    auto vectors = armpp::board::make_irq_vectors<descriptor>(default_handler);
+    vectors[static_cast<std::size_t>(armpp::qemu::board::free_irq)] = probe_irq_handler;
+    return vectors;
+}
+
+struct vector_table {
+    std::uint32_t*                            initial_stack;
+    vector                                    system[15];
+    std::array<vector, descriptor::irq_count> irq;
+};
+
+}    // namespace
+
+[[gnu::section(".isr_vector"), gnu::used]] vector_table const vectors{
+    .initial_stack = _estack,
+    .system        = {
+        reset_handler,
+        default_handler,        // NMI
+        probe_fault_handler,    // HardFault
+        probe_fault_handler,    // MemManage
+        probe_fault_handler,    // BusFault
+        probe_fault_handler,    // UsageFault
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        default_handler,    // SVCall
+        default_handler,    // DebugMonitor
+        nullptr,
+        pendsv_handler,     // PendSV, the kernel context switch
+        system_tick,        // SysTick
+    },
+    .irq = make_irq_vectors(),
+};
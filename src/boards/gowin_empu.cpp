@@ -0,0 +1,28 @@
+/**
+ * Interrupt entry points named in the Gowin EMPU startup files, bound through the board
+ * descriptor. Firmware with its own vector table uses `board::make_irq_vectors` instead.
+ */
+#include <armpp/board/gowin_empu.hpp>
+//
+#include <armpp/hal/ramfunc.hpp>
+
+using armpp::board::gowin_empu;
+
+extern "C" ARMPP_RAMFUNC void
+uart0_handler()
+{
+    gowin_empu::uart0::handler();
+}
+
+extern "C" ARMPP_RAMFUNC void
+uart1_handler()
+{
+    gowin_empu::uart1::handler();
+}
+
+extern "C" ARMPP_RAMFUNC void
+uart_ovr_handler()
+{
+    gowin_empu::uarts::for_each(
+        []<typename Uart>() { typename Uart::handle_type{}->process_overrun_interrupt(); });
+}
@@ -0,0 +1,126 @@
+#include <armpp/coro/executor.hpp>
+//
+#include <armpp/coro/frame_pool.hpp>
+#include <armpp/hal/cpu.hpp>
+
+namespace armpp::coro {
+
+namespace {
+
+constinit default_frame_pool frame_pool_;
+constinit executor           executor_;
+
+}    // namespace
+
+default_frame_pool&
+frame_pool_instance() noexcept
+{
+    return frame_pool_;
+}
+
+executor&
+executor::instance() noexcept
+{
+    return executor_;
+}
+
+bool
+executor::spawn(task<void>&& t) noexcept
+{
+    if (!t)
+        return false;
+    auto handle = t.detach();
+    if (!post(handle)) {
+        handle.destroy();
+        return false;
+    }
+    return true;
+}
+
+bool
+executor::post(std::coroutine_handle<> handle) noexcept
+{
+    return ready_.push(handle);
+}
+
+void
+executor::add_sleeper(sleep_node& node) noexcept
+{
+    // Keep the list ordered by deadline, so only the head is checked on a pass
+    auto* link = &sleepers_;
+    while (*link && (*link)->deadline <= node.deadline) {
+        link = &(*link)->next;
+    }
+    node.next = *link;
+    *link     = &node;
+}
+
+void
+executor::add_poller(poll_node& node) noexcept
+{
+    node.next = pollers_;
+    pollers_  = &node;
+}
+
+void
+executor::wake_sleepers() noexcept
+{
+    if (!sleepers_)
+        return;
+    auto now = hal::system::clock::now();
+    while (sleepers_ && sleepers_->deadline <= now) {
+        auto node = sleepers_;
+        sleepers_ = node->next;
+        if (!post(node->handle)) {
+            // Ready queue is full, retry on the next pass
+            node->next = sleepers_;
+            sleepers_  = node;
+            break;
+        }
+    }
+}
+
+void
+executor::poll() noexcept
+{
+    auto* link = &pollers_;
+    while (*link) {
+        auto node = *link;
+        if (node->predicate(node->context) && post(node->handle)) {
+            *link = node->next;
+        } else {
+            link = &node->next;
+        }
+    }
+}
+
+bool
+executor::run_once() noexcept
+{
+    wake_sleepers();
+    poll();
+    // Resume only the coroutines that were ready at the start of the pass, the ones that yield
+    // go to the next pass
+    std::coroutine_handle<> handle;
+    for (auto count = ready_.size(); count > 0 && ready_.pop(handle); --count) {
+        handle.resume();
+    }
+    return !idle();
+}
+
+void
+executor::run() noexcept
+{
+    while (true) {
+        run_once();
+        // Check for ready coroutines with interrupts masked, a pending interrupt still wakes the
+        // core from WFI, and is serviced after the mask is lifted.
+        hal::cpu::disable_interrupts();
+        if (ready_.empty()) {
+            hal::cpu::wait_for_interrupt();
+        }
+        hal::cpu::enable_interrupts();
+    }
+}
+
+}    // namespace armpp::coro
@@ -0,0 +1,359 @@
+#include <armpp/kernel/kernel.hpp>
+//
+#include <armpp/hal/cpu.hpp>
+#include <armpp/hal/nvic.hpp>
+#include <armpp/hal/ramfunc.hpp>
+#include <armpp/hal/scb.hpp>
+#include <armpp/hal/systick.hpp>
+
+#include <bit>
+
+using armpp::kernel::task_control_block;
+
+// Accessed from the context switch assembly, hence C linkage
+extern "C" {
+[[gnu::used]] task_control_block* armpp_kernel_current  = nullptr;
+[[gnu::used]] task_control_block* armpp_kernel_next     = nullptr;
+[[gnu::used]] std::uint32_t       armpp_kernel_switches = 0;
+}
+
+namespace armpp::kernel {
+
+namespace {
+
+static_assert(priority_levels <= 32, "Ready bitmap is a single word");
+
+constexpr std::uint32_t initial_xpsr     = 0x01000000;    // Thumb bit
+constexpr std::size_t   idle_stack_words = 64;
+constexpr std::uint8_t  lowest_priority  = 0xff;
+constexpr priority_type idle_priority    = 0;
+
+struct ready_queue {
+    task_control_block* head = nullptr;
+    task_control_block* tail = nullptr;
+};
+
+constinit ready_queue         ready_[priority_levels];
+constinit std::uint32_t       ready_bitmap_ = 0;
+constinit task_control_block* sleeping_     = nullptr;
+constinit std::size_t         slice_left_   = time_slice;
+constinit bool                running_      = false;
+
+constinit thread<idle_stack_words> idle_;
+
+void
+push_back(task_control_block& tcb)
+{
+    auto& queue = ready_[tcb.priority];
+    tcb.next    = nullptr;
+    if (queue.tail) {
+        queue.tail->next = &tcb;
+    } else {
+        queue.head = &tcb;
+    }
+    queue.tail = &tcb;
+    tcb.state  = task_state::ready;
+    ready_bitmap_ |= 1u << tcb.priority;
+}
+
+task_control_block*
+pop_front(priority_type priority)
+{
+    auto& queue = ready_[priority];
+    auto  tcb   = queue.head;
+    if (tcb) {
+        queue.head = tcb->next;
+        if (!queue.head) {
+            queue.tail = nullptr;
+            ready_bitmap_ &= ~(1u << priority);
+        }
+        tcb->next = nullptr;
+    }
+    return tcb;
+}
+
+void
+rotate(priority_type priority)
+{
+    auto& queue = ready_[priority];
+    if (queue.head != queue.tail) {
+        push_back(*pop_front(priority));
+    }
+}
+
+priority_type
+highest_ready_priority()
+{
+    // Compiles to a single CLZ on ARMv7-M
+    return static_cast<priority_type>(31 - std::countl_zero(ready_bitmap_));
+}
+
+/**
+ * Pick the highest priority ready task and request a context switch if it is not the current one.
+ * Must be called with interrupts masked.
+ */
+void
+schedule()
+{
+    if (!running_ || !ready_bitmap_)
+        return;
+    auto next = ready_[highest_ready_priority()].head;
+    if (next != armpp_kernel_current) {
+        armpp_kernel_next = next;
+        hal::scb::scb_handle{}->set_pend_sv();
+    }
+}
+
+void
+insert_sleeping(task_control_block& tcb)
+{
+    auto* link = &sleeping_;
+    while (*link && static_cast<std::int32_t>((*link)->wake_tick - tcb.wake_tick) <= 0) {
+        link = &(*link)->next;
+    }
+    tcb.next = *link;
+    *link    = &tcb;
+}
+
+void
+wake_sleeping(tick_type now)
+{
+    while (sleeping_ && static_cast<std::int32_t>(now - sleeping_->wake_tick) >= 0) {
+        auto tcb  = sleeping_;
+        sleeping_ = tcb->next;
+        push_back(*tcb);
+    }
+}
+
+void
+task_exit()
+{
+    {
+        hal::cpu::critical_section cs;
+        auto                       tcb = armpp_kernel_current;
+        pop_front(tcb->priority);
+        tcb->state = task_state::finished;
+        schedule();
+    }
+    // PendSV switches away and never returns here
+    while (true) {}
+}
+
+void
+idle_task(void*)
+{
+    while (true) {
+        hal::cpu::wait_for_interrupt();
+    }
+}
+
+void
+tick()
+{
+    if (!running_)
+        return;
+
+    hal::cpu::critical_section cs;
+    wake_sleeping(hal::system::clock::instance().tick());
+    if (--slice_left_ == 0) {
+        slice_left_ = time_slice;
+        if (ready_bitmap_)
+            rotate(highest_ready_priority());
+    }
+    schedule();
+}
+
+}    // namespace
+
+void
+create(task_control_block& tcb, std::uint32_t* stack, std::size_t stack_words,
+       task_entry_type entry, void* arg, priority_type priority)
+{
+    if (priority >= priority_levels)
+        priority = priority_levels - 1;
+
+    auto to_word = [](auto val) {
+        return static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(val));
+    };
+
+    // Full descending stack, AAPCS requires 8-byte alignment at the exception frame
+    auto sp = stack + (stack_words & ~std::size_t{1});
+
+    // Hardware-stacked frame, popped on exception return
+    *--sp = initial_xpsr;
+    *--sp = to_word(entry) & ~1u;    // PC
+    *--sp = to_word(&task_exit);     // LR
+    *--sp = 0;                       // R12
+    *--sp = 0;                       // R3
+    *--sp = 0;                       // R2
+    *--sp = 0;                       // R1
+    *--sp = to_word(arg);            // R0
+    // R4-R11 restored by PendSV
+    for (auto i = 0; i < 8; ++i) {
+        *--sp = 0;
+    }
+
+    hal::cpu::critical_section cs;
+    tcb.stack_pointer = sp;
+    tcb.priority      = priority;
+    push_back(tcb);
+    schedule();
+}
+
+void
+start()
+{
+    hal::nvic::nvic_handle nvic;
+    nvic->set_irq_priority(hal::irqn::pensv, lowest_priority);
+
+    hal::systick::systick_handle systick;
+    systick->handler_enable();
+    if (!systick->enabled())
+        systick->enable();
+
+    idle_.start(&idle_task, nullptr, idle_priority);
+
+    hal::cpu::disable_interrupts();
+    armpp_kernel_current = nullptr;
+    running_             = true;
+    schedule();
+    hal::cpu::enable_interrupts();
+
+    // The main stack is abandoned, PendSV switches to the first task
+    while (true) {}
+}
+
+void
+yield()
+{
+    hal::cpu::critical_section cs;
+    if (auto tcb = armpp_kernel_current; tcb) {
+        rotate(tcb->priority);
+        slice_left_ = time_slice;
+        schedule();
+    }
+}
+
+void
+sleep(tick_type ticks)
+{
+    hal::cpu::critical_section cs;
+    auto                       tcb = armpp_kernel_current;
+    if (!tcb || ticks == 0)
+        return;
+    pop_front(tcb->priority);
+    tcb->state     = task_state::sleeping;
+    tcb->wake_tick = hal::system::clock::instance().tick() + ticks;
+    insert_sleeping(*tcb);
+    schedule();
+}
+
+task_control_block*
+current() noexcept
+{
+    return armpp_kernel_current;
+}
+
+std::uint32_t
+switch_count() noexcept
+{
+    return armpp_kernel_switches;
+}
+
+}    // namespace armpp::kernel
+
+extern "C" ARMPP_RAMFUNC void
+armpp_kernel_tick()
+{
+    armpp::kernel::tick();
+}
+
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+
+extern "C" [[gnu::naked]] ARMPP_RAMFUNC void
+pendsv_handler()
+{
+    asm volatile(
+        "   cpsid   i                           \n"
+        "   ldr     r3, =armpp_kernel_current   \n"
+        "   ldr     r2, [r3]                    \n"
+        // No task was running when the kernel starts, nothing to save
+        "   cbz     r2, 1f                      \n"
+        "   mrs     r0, psp                     \n"
+        "   stmdb   r0!, {r4-r11}               \n"
+        "   str     r0, [r2]                    \n"
+        "1: ldr     r1, =armpp_kernel_next      \n"
+        "   ldr     r1, [r1]                    \n"
+        "   str     r1, [r3]                    \n"
+        "   ldr     r0, [r1]                    \n"
+        "   ldmia   r0!, {r4-r11}               \n"
+        "   msr     psp, r0                     \n"
+        "   ldr     r0, =armpp_kernel_switches  \n"
+        "   ldr     r2, [r0]                    \n"
+        "   adds    r2, r2, #1                  \n"
+        "   str     r2, [r0]                    \n"
+        "   cpsie   i                           \n"
+        // EXC_RETURN: return to thread mode, use process stack
+        "   mvn     lr, #2                      \n"
+        "   bx      lr                          \n"
+        "   .ltorg                              \n");
+}
+
+#elif defined(__ARM_ARCH_6M__)
+
+// ARMv6-M has no CBZ and transfers only the low registers with STM/LDM, r8-r11 go through r4-r7.
+// The saved frame has the same layout as the ARMv7-M one.
+extern "C" [[gnu::naked]] ARMPP_RAMFUNC void
+pendsv_handler()
+{
+    asm volatile(
+        "   cpsid   i                           \n"
+        "   ldr     r3, =armpp_kernel_current   \n"
+        "   ldr     r2, [r3]                    \n"
+        "   cmp     r2, #0                      \n"
+        "   beq     1f                          \n"
+        "   mrs     r0, psp                     \n"
+        "   subs    r0, r0, #32                 \n"
+        "   str     r0, [r2]                    \n"
+        "   stmia   r0!, {r4-r7}                \n"
+        "   mov     r4, r8                      \n"
+        "   mov     r5, r9                      \n"
+        "   mov     r6, r10                     \n"
+        "   mov     r7, r11                     \n"
+        "   stmia   r0!, {r4-r7}                \n"
+        "1: ldr     r1, =armpp_kernel_next      \n"
+        "   ldr     r1, [r1]                    \n"
+        "   str     r1, [r3]                    \n"
+        "   ldr     r0, [r1]                    \n"
+        "   adds    r0, r0, #16                 \n"
+        "   ldmia   r0!, {r4-r7}                \n"
+        "   mov     r8, r4                      \n"
+        "   mov     r9, r5                      \n"
+        "   mov     r10, r6                     \n"
+        "   mov     r11, r7                     \n"
+        "   msr     psp, r0                     \n"
+        "   subs    r0, r0, #32                 \n"
+        "   ldmia   r0!, {r4-r7}                \n"
+        "   ldr     r0, =armpp_kernel_switches  \n"
+        "   ldr     r2, [r0]                    \n"
+        "   adds    r2, r2, #1                  \n"
+        "   str     r2, [r0]                    \n"
+        "   cpsie   i                           \n"
+        // EXC_RETURN: return to thread mode, use process stack
+        "   ldr     r0, =0xfffffffd             \n"
+        "   bx      r0                          \n"
+        "   .ltorg                              \n");
+}
+
+#else
+
+extern "C" void
+pendsv_handler()
+{
+    // No context to switch outside the target, just track the bookkeeping
+    armpp::hal::cpu::critical_section cs;
+    armpp_kernel_current = armpp_kernel_next;
+    ++armpp_kernel_switches;
+}
+
+#endif
@@ -19,7 +19,7 @@ namespace armpp::hal::nvic {
 
 namespace {
 
-scb::scb_handle scb_handle;
+constinit scb::scb_handle scb_handle;
 
 }    // namespace
 
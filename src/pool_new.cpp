@@ -0,0 +1,167 @@
+#include <armpp/util/pool_new.hpp>
+
+#include <cstddef>
+#include <new>
+
+namespace armpp::util {
+
+namespace {
+
+constinit global_pool_type global_pool_;
+
+void*
+allocate_or_handle(std::size_t size, std::size_t alignment = pool_alignment) noexcept
+{
+    if (alignment > pool_alignment)
+        return nullptr;
+    while (true) {
+        if (auto ptr = global_pool_.allocate(size == 0 ? 1 : size))
+            return ptr;
+        auto handler = std::get_new_handler();
+        if (!handler)
+            return nullptr;
+        handler();
+    }
+}
+
+void*
+allocate_or_fail(std::size_t size, std::size_t alignment = pool_alignment)
+{
+    if (auto ptr = allocate_or_handle(size, alignment))
+        return ptr;
+#if defined(__cpp_exceptions)
+    throw std::bad_alloc{};
+#else
+    __builtin_trap();
+#endif
+}
+
+void
+release(void* ptr) noexcept
+{
+    // A block not from the pools is a heap corruption or a mismatched delete
+    if (!global_pool_.deallocate(ptr))
+        __builtin_trap();
+}
+
+}    // namespace
+
+global_pool_type const&
+global_pool() noexcept
+{
+    return global_pool_;
+}
+
+}    // namespace armpp::util
+
+using armpp::util::allocate_or_fail;
+using armpp::util::allocate_or_handle;
+using armpp::util::release;
+
+void*
+operator new(std::size_t size)
+{
+    return allocate_or_fail(size);
+}
+
+void*
+operator new[](std::size_t size)
+{
+    return allocate_or_fail(size);
+}
+
+void*
+operator new(std::size_t size, std::nothrow_t const&) noexcept
+{
+    return allocate_or_handle(size);
+}
+
+void*
+operator new[](std::size_t size, std::nothrow_t const&) noexcept
+{
+    return allocate_or_handle(size);
+}
+
+void*
+operator new(std::size_t size, std::align_val_t alignment)
+{
+    return allocate_or_fail(size, static_cast<std::size_t>(alignment));
+}
+
+void*
+operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return allocate_or_fail(size, static_cast<std::size_t>(alignment));
+}
+
+void*
+operator new(std::size_t size, std::align_val_t alignment, std::nothrow_t const&) noexcept
+{
+    return allocate_or_handle(size, static_cast<std::size_t>(alignment));
+}
+
+void*
+operator new[](std::size_t size, std::align_val_t alignment, std::nothrow_t const&) noexcept
+{
+    return allocate_or_handle(size, static_cast<std::size_t>(alignment));
+}
+
+void
+operator delete(void* ptr) noexcept
+{
+    release(ptr);
+}
+
+void
+operator delete[](void* ptr) noexcept
+{
+    release(ptr);
+}
+
+void
+operator delete(void* ptr, std::size_t) noexcept
+{
+    release(ptr);
+}
+
+void
+operator delete[](void* ptr, std::size_t) noexcept
+{
+    release(ptr);
+}
+
+void
+operator delete(void* ptr, std::nothrow_t const&) noexcept
+{
+    release(ptr);
+}
+
+void
+operator delete[](void* ptr, std::nothrow_t const&) noexcept
+{
+    release(ptr);
+}
+
+void
+operator delete(void* ptr, std::align_val_t) noexcept
+{
+    release(ptr);
+}
+
+void
+operator delete[](void* ptr, std::align_val_t) noexcept
+{
+    release(ptr);
+}
+
+void
+operator delete(void* ptr, std::size_t, std::align_val_t) noexcept
+{
+    release(ptr);
+}
+
+void
+operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept
+{
+    release(ptr);
+}
@@ -0,0 +1,58 @@
+#include <armpp/hal/simulator.hpp>
+
+#include <array>
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+
+namespace armpp::hal::sim {
+
+namespace {
+
+struct page {
+    address base;
+    alignas(std::max_align_t) std::byte data[page_size];
+};
+
+std::array<page, page_count> pages;
+std::size_t                  used_pages = 0;
+page*                        last_page  = nullptr;
+
+constexpr address page_mask = ~static_cast<address>(page_size - 1);
+
+}    // namespace
+
+void*
+memory(address device_address, [[maybe_unused]] std::size_t size) noexcept
+{
+    auto base   = device_address & page_mask;
+    auto offset = device_address - base;
+    assert(offset + size <= page_size && "Simulated device crosses a page boundary");
+
+    if (last_page && last_page->base == base) {
+        return last_page->data + offset;
+    }
+    for (std::size_t i = 0; i < used_pages; ++i) {
+        if (pages[i].base == base) {
+            last_page = &pages[i];
+            return last_page->data + offset;
+        }
+    }
+    if (used_pages == page_count) {
+        // Out of simulated pages, raise page_count
+        std::abort();
+    }
+    last_page       = &pages[used_pages++];
+    last_page->base = base;
+    return last_page->data + offset;
+}
+
+void
+reset() noexcept
+{
+    for (std::size_t i = 0; i < used_pages; ++i) {
+        std::memset(pages[i].data, 0, page_size);
+    }
+}
+
+}    // namespace armpp::hal::sim
@@ -0,0 +1,156 @@
+#include <armpp/hal/startup.hpp>
+//
+#include <armpp/hal/core.hpp>
+#include <armpp/hal/cpu.hpp>
+#include <armpp/hal/dwt.hpp>
+#include <armpp/hal/system.hpp>
+
+namespace armpp::hal::startup {
+
+namespace {
+
+std::uint32_t boot_cycles_ = 0;
+
+}    // namespace
+
+std::uint32_t
+boot_cycles() noexcept
+{
+    return boot_cycles_;
+}
+
+}    // namespace armpp::hal::startup
+
+extern "C" [[gnu::weak]] void
+armpp_boot_complete(std::uint32_t)
+{}
+
+#if defined(__arm__)
+
+// Defined by the linker script
+extern "C" {
+extern std::uint32_t const _sidata[];
+extern std::uint32_t       _sdata[];
+extern std::uint32_t       _edata[];
+extern std::uint32_t       _sbss[];
+extern std::uint32_t       _ebss[];
+
+// Weak, so that a firmware without ARMPP_RAMFUNC code doesn't need the section
+[[gnu::weak]] extern std::uint32_t const _siramfunc[];
+[[gnu::weak]] extern std::uint32_t       _sramfunc[];
+[[gnu::weak]] extern std::uint32_t       _eramfunc[];
+
+using init_function = void (*)();
+extern init_function const __preinit_array_start[];
+extern init_function const __preinit_array_end[];
+extern init_function const __init_array_start[];
+extern init_function const __init_array_end[];
+}
+
+// Calling main from C++ code is not allowed, refer to the symbol by the assembler name instead
+extern "C" int
+application_main() asm("main");
+
+namespace {
+
+/**
+ * Copy words from src to [dst, end). Four words per iteration, the rest one by one. Only low
+ * registers are used, so the loop is valid for ARMv6-M as well.
+ */
+[[gnu::always_inline]] inline void
+copy_words(std::uint32_t const* src, std::uint32_t* dst, std::uint32_t const* end)
+{
+    auto bytes = static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(end)
+                                            - reinterpret_cast<std::uintptr_t>(dst));
+    asm volatile(
+        "   subs    %[n], %[n], #16         \n"
+        "   blo     2f                      \n"
+        "1: ldmia   %[src]!, {r3-r6}        \n"
+        "   stmia   %[dst]!, {r3-r6}        \n"
+        "   subs    %[n], %[n], #16         \n"
+        "   bhs     1b                      \n"
+        "2: adds    %[n], %[n], #16         \n"
+        "   beq     4f                      \n"
+        "3: ldmia   %[src]!, {r3}           \n"
+        "   stmia   %[dst]!, {r3}           \n"
+        "   subs    %[n], %[n], #4          \n"
+        "   bne     3b                      \n"
+        "4:                                 \n"
+        : [src] "+l"(src), [dst] "+l"(dst), [n] "+l"(bytes)
+        :
+        : "r3", "r4", "r5", "r6", "cc", "memory");
+}
+
+/**
+ * Zero words in [dst, end), four words per iteration.
+ */
+[[gnu::always_inline]] inline void
+zero_words(std::uint32_t* dst, std::uint32_t const* end)
+{
+    auto bytes = static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(end)
+                                            - reinterpret_cast<std::uintptr_t>(dst));
+    asm volatile(
+        "   movs    r3, #0                  \n"
+        "   movs    r4, #0                  \n"
+        "   movs    r5, #0                  \n"
+        "   movs    r6, #0                  \n"
+        "   subs    %[n], %[n], #16         \n"
+        "   blo     2f                      \n"
+        "1: stmia   %[dst]!, {r3-r6}        \n"
+        "   subs    %[n], %[n], #16         \n"
+        "   bhs     1b                      \n"
+        "2: adds    %[n], %[n], #16         \n"
+        "   beq     4f                      \n"
+        "3: stmia   %[dst]!, {r3}           \n"
+        "   subs    %[n], %[n], #4          \n"
+        "   bne     3b                      \n"
+        "4:                                 \n"
+        : [dst] "+l"(dst), [n] "+l"(bytes)
+        :
+        : "r3", "r4", "r5", "r6", "cc", "memory");
+}
+
+[[gnu::always_inline]] inline void
+run_init_array(init_function const* begin, init_function const* end)
+{
+    for (; begin != end; ++begin) {
+        (*begin)();
+    }
+}
+
+}    // namespace
+
+extern "C" [[noreturn]] void
+reset_handler()
+{
+    using namespace armpp::hal;
+
+    if constexpr (core::current::cycle_counter) {
+        dwt::start_cycle_counter();
+    }
+
+    copy_words(_sidata, _sdata, _edata);
+    copy_words(_siramfunc, _sramfunc, _eramfunc);
+    zero_words(_sbss, _ebss);
+    // The code copied to RAM must be visible to instruction fetches
+    cpu::data_sync_barrier();
+    cpu::instruction_sync_barrier();
+
+    // Bring up the clock first, so that the constructors run at full speed and can rely on
+    // system::clock
+    system_init();
+
+    run_init_array(__preinit_array_start, __preinit_array_end);
+    run_init_array(__init_array_start, __init_array_end);
+
+    if constexpr (core::current::cycle_counter) {
+        startup::boot_cycles_ = dwt::dwt_handle{}->cycles();
+    }
+    armpp_boot_complete(startup::boot_cycles_);
+
+    application_main();
+
+    while (true) {}
+}
+
+#endif
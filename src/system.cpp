@@ -1,5 +1,6 @@
 #include <armpp/hal/system.hpp>
 //
+#include <armpp/hal/ramfunc.hpp>
 #include <armpp/hal/systick.hpp>
 
 #ifndef ARMPP_SYSTEM_FREQUENCY
@@ -23,27 +24,22 @@ system_init()
     systick->enable();
 }
 
-void
+// Defined when the preemptive kernel is linked in
+extern "C" [[gnu::weak]] void
+armpp_kernel_tick();
+
+ARMPP_RAMFUNC void
 system_tick()
 {
     using namespace armpp::hal::system;
     clock::mutable_instance().increment_tick();
+    if (armpp_kernel_tick) {
+        armpp_kernel_tick();
+    }
 }
 
 namespace armpp::hal::system {
 
-clock&
-clock::mutable_instance()
-{
-
-    static clock instance_;
-    return instance_;
-}
-
-clock const&
-clock::instance()
-{
-    return mutable_instance();
-}
+constinit clock clock::instance_;
 
 }    // namespace armpp::hal::system
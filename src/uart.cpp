@@ -1,6 +1,7 @@
 #include <armpp/hal/uart.hpp>
 //
-#include <armpp/hal/addresses.hpp>
+#include <armpp/board/current.hpp>
+#include <armpp/hal/ramfunc.hpp>
 #include <armpp/hal/system.hpp>
 
 #include <array>
@@ -10,41 +11,41 @@ namespace armpp::hal::uart {
 
 namespace {
 
-// TODO Move to vendor-specific files
-constexpr std::size_t uart_count = 2;
-
-std::array<address, uart_count> uart_devices{uart0_address, uart1_address};
+using uarts = board::current::uarts;
 
 struct uart_handlers {
-    uart const*             address;
     uart::tx_callback_type  tx_callback;
     uart::rx_callback_type  rx_callback;
     uart::ovr_callback_type tx_ovr_callback;
     uart::ovr_callback_type rx_ovr_callback;
-
-    uart_handlers()
-        : address{nullptr},
-          tx_callback{nullptr},
-          rx_callback{nullptr},
-          tx_ovr_callback{nullptr},
-          rx_ovr_callback{nullptr}
-    {}
 };
 
-std::array<uart_handlers, uart_count> handlers;
+constinit std::array<uart_handlers, uarts::size> handlers;
+
+// Interrupt status and state register bits, to test and clear several sources at once
+constexpr raw_register tx_interrupt_mask = util::bit_mask_v<0, 1, raw_register>;
+constexpr raw_register rx_interrupt_mask = util::bit_mask_v<1, 1, raw_register>;
+constexpr raw_register tx_overrun_mask   = util::bit_mask_v<2, 1, raw_register>;
+constexpr raw_register rx_overrun_mask   = util::bit_mask_v<3, 1, raw_register>;
 
-uart_handlers&
+ARMPP_RAMFUNC uart_handlers&
 get_handlers(uart const* device)
 {
-    for (auto& hndlrs : handlers) {
-        if (hndlrs.address == device) {
-            return hndlrs;
-        } else if (hndlrs.address == nullptr) {
-            hndlrs.address = device;
-            return hndlrs;
+    auto index = uarts::index_of(device);
+    assert(index != uarts::npos && "The UART is not listed in the board descriptor");
+    return handlers[index];
+}
+
+std::uint32_t
+clock_frequency(uart const* device)
+{
+    auto divider = 1u;
+    uarts::for_each([&]<typename Peripheral>() {
+        if (&Peripheral::device() == device) {
+            divider = board::current::clock_divider(Peripheral::clock);
         }
-    }
-    assert(false);
+    });
+    return system::clock::instance().system_frequency().count() / divider;
 }
 
 }    // namespace
@@ -70,32 +71,71 @@ uart::configure(uart_init const& init)
 
     ctrl_.raw = 0;
     ctrl_.raw = new_ctrl.raw;
-    // TODO replace with required clock control
-    bauddiv_ = system::clock::instance().system_frequency().count() / init.baud_rate;
+    bauddiv_ = clock_frequency(this) / init.baud_rate;
 }
 
 void
+uart::snapshot::set_baud_rate(std::uint32_t baud_rate) noexcept
+{
+    set_baud_divider(clock_frequency(&device()) / baud_rate);
+}
+
+void
+uart::snapshot::apply(uart_init const& init) noexcept
+{
+    auto& ctrl = control();
+
+    ctrl.tx_enable                   = init.enable.tx;
+    ctrl.rx_enable                   = init.enable.rx;
+    ctrl.tx_interrupt_enable         = init.enable_interrupt.tx;
+    ctrl.rx_interrupt_enable         = init.enable_interrupt.rx;
+    ctrl.tx_overrun_interrupt_enable = init.enable_overrun_interrupt.tx;
+    ctrl.rx_overrun_interrupt_enable = init.enable_overrun_interrupt.rx;
+    ctrl.hs_test_mode                = init.enable_hs_test_mode;
+    set_baud_rate(init.baud_rate);
+}
+
+ARMPP_RAMFUNC void
 uart::process_interrupt()
 {
     auto&       hndlrs = get_handlers(this);
     uart_handle handle{*this};
-    if (rx_interrupt() && hndlrs.rx_callback) {
-        clear_rx_interrupt();
+    // Every pending source with a handler is serviced in one pass, the status is read once and
+    // the serviced sources are cleared with a single store
+    raw_register pending = interrupt_.raw & (tx_interrupt_mask | rx_interrupt_mask);
+    if (!hndlrs.rx_callback) {
+        pending &= ~rx_interrupt_mask;
+    }
+    if (!hndlrs.tx_callback) {
+        pending &= ~tx_interrupt_mask;
+    }
+    if (pending == 0) {
+        return;
+    }
+    interrupt_.raw = pending;
+    if (pending & rx_interrupt_mask) {
         hndlrs.rx_callback(handle, data_.get());
-    } else if (tx_interrupt() && hndlrs.tx_callback) {
-        clear_tx_interrupt();
+    }
+    if (pending & tx_interrupt_mask) {
         hndlrs.tx_callback(handle);
     }
 }
 
-void
+ARMPP_RAMFUNC void
 uart::process_overrun_interrupt()
 {
-    auto&       hndlrs = get_handlers(this);
-    uart_handle handle{*this};
-    if (tx_buffer_overrun() && hndlrs.tx_ovr_callback) {
+    auto&        hndlrs  = get_handlers(this);
+    uart_handle  handle{*this};
+    raw_register overrun = state_.raw & (tx_overrun_mask | rx_overrun_mask);
+    if (overrun == 0) {
+        return;
+    }
+    // Both overrun flags are cleared with one store, the buffer full bits are read only
+    state_.raw = overrun;
+    if ((overrun & tx_overrun_mask) && hndlrs.tx_ovr_callback) {
         hndlrs.tx_ovr_callback(handle);
-    } else if (rx_buffer_overrun() && hndlrs.rx_ovr_callback) {
+    }
+    if ((overrun & rx_overrun_mask) && hndlrs.rx_ovr_callback) {
         hndlrs.rx_ovr_callback(handle);
     }
 }
@@ -129,30 +169,3 @@ uart::set_rx_overrun_handler(uart::ovr_callback_type&& cb)
 }
 
 }    // namespace armpp::hal::uart
-
-// TODO Move to vendor-specific files
-extern "C" void
-uart0_handler()
-{
-    using namespace armpp::hal::uart;
-    uart_handle handle{armpp::hal::uart0_address};
-    handle->process_interrupt();
-}
-
-extern "C" void
-uart1_handler()
-{
-    using namespace armpp::hal::uart;
-    uart_handle handle{armpp::hal::uart0_address};
-    handle->process_interrupt();
-}
-
-extern "C" void
-uart_ovr_handler()
-{
-    using namespace armpp::hal::uart;
-    for (auto addr : uart_devices) {
-        uart_handle handle{addr};
-        handle->process_overrun_interrupt();
-    }
-}
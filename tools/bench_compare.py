@@ -0,0 +1,57 @@
+#!/usr/bin/env python3
+"""Compare two armpp_bench JSON reports.
+
+Usage: bench_compare.py <baseline.json> <current.json> [--threshold <percent>]
+
+Prints the ns/op and allocation changes per benchmark. Exits with status 1 when a benchmark got
+slower than the threshold (default 10%) or started allocating.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load(path):
+    with open(path) as f:
+        return {b["name"]: b for b in json.load(f)["benchmarks"]}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--threshold", type=float, default=10.0,
+                        help="slowdown in percent reported as a regression")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline)
+    current = load(args.current)
+
+    regressions = 0
+    print(f"{'benchmark':44} {'base ns/op':>12} {'ns/op':>12} {'change':>9} {'allocs/op':>10}")
+    for name in sorted(baseline.keys() | current.keys()):
+        if name not in current:
+            print(f"{name:44} {'removed':>12}")
+            continue
+        cur = current[name]
+        if name not in baseline:
+            print(f"{name:44} {'new':>12} {cur['ns_per_op']:12.3f}")
+            continue
+        base = baseline[name]
+        change = (cur["ns_per_op"] / base["ns_per_op"] - 1) * 100 if base["ns_per_op"] else 0.0
+        mark = ""
+        if change > args.threshold:
+            mark = "  SLOWER"
+            regressions += 1
+        if cur["allocs_per_op"] > base["allocs_per_op"]:
+            mark += "  ALLOCATES"
+            regressions += 1
+        print(f"{name:44} {base['ns_per_op']:12.3f} {cur['ns_per_op']:12.3f} {change:8.1f}% "
+              f"{cur['allocs_per_op']:10.3f}{mark}")
+
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,141 @@
+#!/usr/bin/env python3
+"""Check instruction and byte counts of code generation probes against budgets.
+
+Usage: codegen_budget.py --budgets budgets.json --core cortex-m3 --compiler GNU-13
+                         [--update [--headroom <percent>]] <object|archive>...
+
+The functions listed in the `probes` section of the budgets file are looked up in the objects
+and disassembled. For every probe:
+
+- the instruction count and the size in bytes must not exceed the budget recorded for the core
+  and the compiler, the code of another compiler or version is not held to those numbers
+- a probe with a `reference` must not have more instructions than the referenced probe plus the
+  `allowance`, the references are the hand-written C versions of the operations
+
+With --update the current counts plus the headroom are written to the budgets file as the new
+budgets for the core and the compiler. The headroom absorbs the small differences between the
+patch releases of a compiler, the references keep the exact comparison.
+Literal pool words are counted in bytes, not in instructions.
+"""
+
+import argparse
+import json
+import math
+import re
+import subprocess
+import sys
+
+FUNCTION_RE = re.compile(r"^[0-9a-f]+ <(.+)>:$")
+ADDRESS_RE = re.compile(r"^\s*[0-9a-f]+:$")
+DATA_DIRECTIVES = {".word", ".short", ".byte", ".long", ".inst"}
+
+
+def function_sizes(nm, objects):
+    sizes = {}
+    output = subprocess.run([nm, "-C", "-S", "--defined-only", *objects],
+                            capture_output=True, text=True, check=True).stdout
+    for line in output.splitlines():
+        fields = line.split(maxsplit=3)
+        if len(fields) == 4 and fields[2] in "TtWw":
+            sizes[fields[3]] = int(fields[1], 16)
+    return sizes
+
+
+def instruction_counts(objdump, objects):
+    counts = {}
+    output = subprocess.run([objdump, "-d", "-C", *objects],
+                            capture_output=True, text=True, check=True).stdout
+    current = None
+    for line in output.splitlines():
+        match = FUNCTION_RE.match(line)
+        if match:
+            current = match.group(1)
+            counts.setdefault(current, 0)
+            continue
+        if current is None:
+            continue
+        # <address>:\t<encoding>\t<mnemonic>\t<operands>, long x86 encodings continue on the
+        # next line without a mnemonic
+        fields = line.split("\t")
+        if len(fields) < 3 or not ADDRESS_RE.match(fields[0]) or not fields[2].strip():
+            continue
+        if fields[2].split()[0] not in DATA_DIRECTIVES:
+            counts[current] += 1
+    return counts
+
+
+def measure(probes, sizes, counts):
+    result = {}
+    for name, probe in probes.items():
+        symbol = probe["symbol"]
+        if symbol not in sizes or symbol not in counts:
+            raise SystemExit(f"Probe {name}: symbol `{symbol}` not found")
+        result[name] = {"instructions": counts[symbol], "bytes": sizes[symbol]}
+    return result
+
+
+def with_headroom(measured, headroom):
+    return {name: {key: value + math.ceil(value * headroom / 100) for key, value in values.items()}
+            for name, values in measured.items()}
+
+
+def check(probes, measured, budgets):
+    failures = []
+    if not budgets:
+        print("No budgets recorded for the core and the compiler, run with --update to record them")
+    print(f"{'probe':28} {'insns':>6} {'budget':>7} {'bytes':>6} {'budget':>7} {'reference':>10}")
+    for name, values in measured.items():
+        budget = budgets.get(name, {})
+        reference = probes[name].get("reference")
+        ref_text = ""
+        if reference:
+            limit = measured[reference]["instructions"] + probes[name].get("allowance", 0)
+            ref_text = f"<= {limit}"
+            if values["instructions"] > limit:
+                failures.append(f"{name}: {values['instructions']} instructions, "
+                                f"the C version {reference} takes {limit}")
+        for key in ("instructions", "bytes"):
+            if key in budget and values[key] > budget[key]:
+                failures.append(f"{name}: {values[key]} {key}, budget {budget[key]}")
+        print(f"{name:28} {values['instructions']:6} {budget.get('instructions', '-'):>7} "
+              f"{values['bytes']:6} {budget.get('bytes', '-'):>7} {ref_text:>10}")
+    return failures
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("objects", nargs="+")
+    parser.add_argument("--budgets", required=True)
+    parser.add_argument("--core", required=True)
+    parser.add_argument("--compiler", required=True, help="compiler id and major version")
+    parser.add_argument("--objdump", default="arm-none-eabi-objdump")
+    parser.add_argument("--nm", default="arm-none-eabi-nm")
+    parser.add_argument("--update", action="store_true", help="record the current counts")
+    parser.add_argument("--headroom", type=int, default=10,
+                        help="percent added to the recorded counts (default 10)")
+    args = parser.parse_args()
+
+    with open(args.budgets) as f:
+        config = json.load(f)
+    probes = config["probes"]
+
+    measured = measure(probes, function_sizes(args.nm, args.objects),
+                       instruction_counts(args.objdump, args.objects))
+
+    key = f"{args.core}/{args.compiler}"
+    if args.update:
+        config.setdefault("budgets", {})[key] = with_headroom(measured, args.headroom)
+        with open(args.budgets, "w") as f:
+            json.dump(config, f, indent=2)
+            f.write("\n")
+        print(f"Budgets for {key} written to {args.budgets}")
+        return 0
+
+    failures = check(probes, measured, config.get("budgets", {}).get(key, {}))
+    for failure in failures:
+        print(f"error: {failure}", file=sys.stderr)
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,368 @@
+#!/usr/bin/env python3
+"""Flash and RAM footprint report from a GNU ld map file.
+
+Usage: footprint_report.py <firmware.map> [--baseline old.json] [--json new.json] [--top N]
+
+Every input section of the map is attributed to a category:
+
+- armpp subsystems (registers, uart, timer, nvic, scb, system, kernel, coro, util), by the
+  library object or, for the header only code inlined into the application, by the namespace
+  of the function
+- the parts of the C++ runtime that are expensive on a microcontroller: std::function,
+  iostream, exceptions, rtti, operator new/delete, and the rest of libstdc++
+- libc, libgcc and the application
+
+Flash counts the code, the read-only data and the load image of initialized data, RAM counts
+initialized and zeroed data and the code copied to RAM. Exception handling, RTTI and iostream
+code is flagged as an unexpected pull, --fail-on-pull turns the warnings into errors. With
+--baseline the categories and the largest symbol changes are compared with a previous report.
+"""
+
+import argparse
+import json
+import re
+import shutil
+import subprocess
+import sys
+from collections import defaultdict
+
+MEMORY_RE = re.compile(r"^(\S+)\s+(0x[0-9a-fA-F]+)\s+(0x[0-9a-fA-F]+)(?:\s+(\S+))?\s*$")
+OUTPUT_RE = re.compile(
+    r"^(\.\S+)(?:\s+(0x[0-9a-fA-F]+)\s+(0x[0-9a-fA-F]+)(?:\s+load address\s+(0x[0-9a-fA-F]+))?)?\s*$")
+INPUT_RE = re.compile(r"^ (\.\S+|COMMON)(?:\s+(0x[0-9a-fA-F]+)\s+(0x[0-9a-fA-F]+)\s+(.+))?\s*$")
+CONTINUATION_RE = re.compile(
+    r"^\s+(0x[0-9a-fA-F]+)\s+(0x[0-9a-fA-F]+)(?:\s+load address\s+(0x[0-9a-fA-F]+)|\s+(.+))?\s*$")
+FILL_RE = re.compile(r"^ \*fill\*\s+(0x[0-9a-fA-F]+)\s+(0x[0-9a-fA-F]+)")
+LIBRARY_RE = re.compile(r"([^/\\]+)\.a\(([^)]+)\)$")
+MERGED_RE = re.compile(r"^(str\d|cst\d|local$|ro$)")
+
+NOT_ALLOCATED = (".debug", ".comment", ".ARM.attributes", ".stab", ".gnu.attributes",
+                 ".gnu_debuglink")
+FLASH_SECTIONS = (".isr_vector", ".text", ".rodata", ".ARM.exidx", ".ARM.extab", ".init_array",
+                  ".preinit_array", ".fini_array", ".init", ".fini", ".eh_frame",
+                  ".gcc_except_table")
+RAM_AND_FLASH_SECTIONS = (".data", ".ramfunc")
+
+NO_BASELINE = {"flash": None, "ram": None}
+
+UNEXPECTED = ("exceptions", "rtti", "iostream")
+
+ARMPP_OBJECTS = {
+    "uart": "uart",
+    "timer": "timer",
+    "nvic": "nvic",
+    "system": "system",
+    "startup": "system",
+    "kernel": "kernel",
+    "coro": "coro",
+}
+
+# Checked in order, the first match wins
+SYMBOL_CATEGORIES = [
+    (re.compile(r"std::function|std::_Function_base|bad_function_call|_Function_handler"),
+     "std::function"),
+    (re.compile(r"__cxa_throw|__cxa_begin_catch|__cxa_end_catch|__cxa_allocate_exception|"
+                r"_Unwind_|__gxx_personality|__aeabi_unwind|__cxa_call_unexpected"),
+     "exceptions"),
+    (re.compile(r"^typeinfo |^typeinfo name |__cxxabiv1::|__dynamic_cast"), "rtti"),
+    (re.compile(r"std::basic_ostream|std::basic_istream|std::ios_base|std::basic_ios|"
+                r"std::locale|std::basic_streambuf"), "iostream"),
+    (re.compile(r"armpp::hal::(detail::)?(register_|array_field|read_write_register|"
+                r"read_only_register|write_only_register)"), "registers"),
+    (re.compile(r"armpp::hal::uart\b"), "uart"),
+    (re.compile(r"armpp::hal::timer\b"), "timer"),
+    (re.compile(r"armpp::hal::nvic\b"), "nvic"),
+    (re.compile(r"armpp::hal::scb\b"), "scb"),
+    (re.compile(r"armpp::hal::(system|systick|dwt|startup)\b|\bsystem_(init|tick)\b"), "system"),
+    (re.compile(r"armpp::kernel\b"), "kernel"),
+    (re.compile(r"armpp::coro\b"), "coro"),
+    (re.compile(r"armpp::util\b"), "util"),
+    (re.compile(r"armpp::"), "armpp"),
+]
+
+STDLIB_MEMBERS = [
+    (re.compile(r"^functional\."), "std::function"),
+    (re.compile(r"^(eh_|unwind|pr-support|libunwind|vterminate|functexcept|cow-stdexcept|"
+                r"stdexcept|system_error)"), "exceptions"),
+    (re.compile(r"^(tinfo|class_type_info|si_class_type_info|vmi_class_type_info|"
+                r"pbase_type_info|pointer_type_info|fundamental_type_info|dyncast|bad_cast|"
+                r"bad_typeid)"), "rtti"),
+    (re.compile(r"^(ios|iostream|locale|.*stream|.*streambuf|codecvt|ctype|globals_io|"
+                r"basic_file|compatibility)"), "iostream"),
+    (re.compile(r"^(new_op|del_op|new_handler|bad_alloc)"), "operator new/delete"),
+]
+
+
+def demangle(names, cxxfilt):
+    if not names or not cxxfilt:
+        return {name: name for name in names}
+    output = subprocess.run([cxxfilt], input="\n".join(names), capture_output=True, text=True,
+                            check=True).stdout.splitlines()
+    return dict(zip(names, output))
+
+
+def section_symbol(section):
+    """Function or object name from a -ffunction-sections/-fdata-sections section name"""
+    for prefix in (".text.unlikely.", ".text.hot.", ".text.startup.", ".text.", ".rodata.",
+                   ".data.rel.ro.local.", ".data.rel.ro.", ".data.rel.local.", ".data.rel.",
+                   ".data.", ".bss.", ".ramfunc.", ".tbss.", ".tdata."):
+        if section.startswith(prefix):
+            name = section[len(prefix):]
+            # Merged string and constant pools
+            return "" if MERGED_RE.match(name) else name
+    return ""
+
+
+def parse_map(path):
+    """Return the memory regions and the allocated input sections of a map file"""
+    regions = []
+    sections = []
+    with open(path) as f:
+        lines = f.read().splitlines()
+
+    state = "start"
+    output = None
+    pending_input = None
+    pending_output = None
+    for line in lines:
+        if line.startswith("Memory Configuration"):
+            state = "memory"
+            continue
+        if line.startswith("Linker script and memory map"):
+            state = "map"
+            continue
+        if line.startswith("Cross Reference Table"):
+            break
+        if state == "memory":
+            match = MEMORY_RE.match(line)
+            if match and match.group(1) not in ("Name", "*default*"):
+                regions.append({"name": match.group(1), "origin": int(match.group(2), 16),
+                                "length": int(match.group(3), 16),
+                                "attributes": match.group(4) or ""})
+            continue
+        if state != "map":
+            continue
+
+        if pending_output is not None:
+            match = CONTINUATION_RE.match(line)
+            if match:
+                output = {"name": pending_output, "address": int(match.group(1), 16),
+                          "load": int(match.group(3), 16) if match.group(3) else None}
+            pending_output = None
+            continue
+        if pending_input is not None:
+            match = CONTINUATION_RE.match(line)
+            pending_name = pending_input
+            pending_input = None
+            if match and match.group(4):
+                sections.append((output, pending_name, int(match.group(2), 16), match.group(4)))
+            continue
+
+        match = OUTPUT_RE.match(line)
+        if match:
+            if match.group(2) is None:
+                pending_output = match.group(1)
+                output = None
+            else:
+                output = {"name": match.group(1), "address": int(match.group(2), 16),
+                          "load": int(match.group(4), 16) if match.group(4) else None}
+            continue
+        if output is None:
+            continue
+        match = FILL_RE.match(line)
+        if match:
+            sections.append((output, "*fill*", int(match.group(2), 16), ""))
+            continue
+        match = INPUT_RE.match(line)
+        if match:
+            if match.group(2) is None:
+                pending_input = match.group(1)
+            else:
+                sections.append((output, match.group(1), int(match.group(3), 16),
+                                 match.group(4)))
+    return regions, sections
+
+
+def region_of(address, regions):
+    for region in regions:
+        if region["origin"] <= address < region["origin"] + region["length"]:
+            return region
+    return None
+
+
+def is_flash(region):
+    name = region["name"].upper()
+    if any(key in name for key in ("FLASH", "ROM", "CODE")):
+        return True
+    return "x" in region["attributes"] and "w" not in region["attributes"]
+
+
+def placement(output, regions):
+    """Return (flash, ram) flags for an output section"""
+    name = output["name"]
+    if name.startswith(NOT_ALLOCATED):
+        return False, False
+    region = region_of(output["address"], regions) if regions else None
+    if region is not None:
+        in_flash = is_flash(region)
+        load = output["load"]
+        loaded_from_flash = (load is not None and load != output["address"]
+                             and (region_of(load, regions) is None
+                                  or is_flash(region_of(load, regions))))
+        return in_flash or loaded_from_flash, not in_flash
+    # No memory configuration, guess by the section name
+    if name.startswith(RAM_AND_FLASH_SECTIONS):
+        return True, True
+    if name.startswith(FLASH_SECTIONS):
+        return True, False
+    return False, True
+
+
+def classify(obj, section, symbol):
+    if section == "*fill*":
+        return "padding"
+    if section.startswith((".ARM.extab", ".gcc_except_table")):
+        return "exceptions"
+    if section.startswith((".ARM.exidx", ".eh_frame")):
+        return "unwind tables"
+    for pattern, category in SYMBOL_CATEGORIES:
+        if symbol and pattern.search(symbol):
+            return category
+    match = LIBRARY_RE.search(obj)
+    if match:
+        library, member = match.groups()
+        if library == "libarmpp":
+            return ARMPP_OBJECTS.get(member.split(".")[0], "armpp")
+        if library in ("libstdc++", "libsupc++", "libstdc++_nano", "libsupc++_nano"):
+            for pattern, category in STDLIB_MEMBERS:
+                if pattern.search(member):
+                    return category
+            return "libstdc++"
+        if library.startswith("libgcc"):
+            if re.match(r"(unwind|pr-support|libunwind)", member):
+                return "exceptions"
+            return "libgcc"
+        if library.startswith(("libc", "libg", "libm", "libnosys")):
+            return "libc"
+        return library
+    return "application"
+
+
+def build_report(map_file, cxxfilt):
+    regions, sections = parse_map(map_file)
+    mangled = sorted({section_symbol(section) for _, section, _, _ in sections} - {""})
+    names = demangle(mangled, cxxfilt)
+
+    categories = defaultdict(lambda: {"flash": 0, "ram": 0})
+    symbols = defaultdict(lambda: {"flash": 0, "ram": 0, "category": "", "object": ""})
+    for output, section, size, obj in sections:
+        if size == 0:
+            continue
+        flash, ram = placement(output, regions)
+        if not flash and not ram:
+            continue
+        symbol = names.get(section_symbol(section), "")
+        category = classify(obj, section, symbol)
+        if section == "*fill*":
+            key = section
+        else:
+            key = symbol or f"{section} ({obj.split('/')[-1]})"
+        for kind, used in (("flash", flash), ("ram", ram)):
+            if used:
+                categories[category][kind] += size
+                symbols[key][kind] += size
+        symbols[key]["category"] = category
+        symbols[key]["object"] = obj.split("/")[-1]
+
+    totals = {
+        "flash": sum(c["flash"] for c in categories.values()),
+        "ram": sum(c["ram"] for c in categories.values()),
+    }
+    return {
+        "totals": totals,
+        "categories": dict(sorted(categories.items())),
+        "symbols": dict(sorted(symbols.items())),
+    }
+
+
+def delta(value, base):
+    if base is None:
+        return ""
+    diff = value - base
+    return f"{diff:+d}" if diff else ""
+
+
+def print_report(report, baseline, top):
+    base_categories = baseline["categories"] if baseline else {}
+    print(f"{'category':24} {'flash':>9} {'':>8} {'ram':>9} {'':>8}")
+    for name, sizes in report["categories"].items():
+        base = base_categories.get(name, {"flash": 0, "ram": 0} if baseline else NO_BASELINE)
+        print(f"{name:24} {sizes['flash']:9} {delta(sizes['flash'], base['flash']):>8} "
+              f"{sizes['ram']:9} {delta(sizes['ram'], base['ram']):>8}")
+    for name in base_categories.keys() - report["categories"].keys():
+        base = base_categories[name]
+        print(f"{name:24} {0:9} {delta(0, base['flash']):>8} {0:9} {delta(0, base['ram']):>8}")
+    totals = report["totals"]
+    base_totals = baseline["totals"] if baseline else NO_BASELINE
+    print(f"{'total':24} {totals['flash']:9} {delta(totals['flash'], base_totals['flash']):>8} "
+          f"{totals['ram']:9} {delta(totals['ram'], base_totals['ram']):>8}")
+
+    for kind in ("flash", "ram"):
+        print(f"\nTop {top} {kind} contributors:")
+        largest = sorted(report["symbols"].items(), key=lambda item: -item[1][kind])[:top]
+        for name, sizes in largest:
+            if sizes[kind]:
+                print(f"  {sizes[kind]:8}  {sizes['category']:20} {name}")
+
+    if baseline:
+        base_symbols = baseline["symbols"]
+        changes = []
+        for name in report["symbols"].keys() | base_symbols.keys():
+            cur = report["symbols"].get(name, {"flash": 0, "ram": 0})
+            base = base_symbols.get(name, {"flash": 0, "ram": 0})
+            diff = (cur["flash"] - base["flash"], cur["ram"] - base["ram"])
+            if diff != (0, 0):
+                changes.append((abs(diff[0]) + abs(diff[1]), diff, name))
+        if changes:
+            print(f"\nLargest changes since the baseline (flash, ram):")
+            for _, diff, name in sorted(changes, reverse=True)[:top]:
+                print(f"  {diff[0]:+8} {diff[1]:+8}  {name}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("map")
+    parser.add_argument("--baseline", help="JSON report to compare with")
+    parser.add_argument("--json", help="write the report as JSON")
+    parser.add_argument("--top", type=int, default=10, help="number of top contributors")
+    parser.add_argument("--cxxfilt", default=shutil.which("c++filt"),
+                        help="c++filt used to demangle the section names")
+    parser.add_argument("--fail-on-pull", action="store_true",
+                        help="fail when exception handling, RTTI or iostream code is linked")
+    args = parser.parse_args()
+
+    report = build_report(args.map, args.cxxfilt)
+    baseline = None
+    if args.baseline:
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+
+    print_report(report, baseline, args.top)
+
+    pulls = [name for name in UNEXPECTED if report["categories"].get(name, {}).get("flash")]
+    for name in pulls:
+        culprits = [symbol for symbol, sizes in report["symbols"].items()
+                    if sizes["category"] == name]
+        print(f"warning: {name} code linked ({report['categories'][name]['flash']} bytes), "
+              f"e.g. {', '.join(culprits[:3])}", file=sys.stderr)
+
+    if args.json:
+        with open(args.json, "w") as f:
+            json.dump(report, f, indent=2)
+            f.write("\n")
+
+    return 1 if pulls and args.fail_on_pull else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+"""Decode the LZSS stream written by util::lzss_encoder and hal::uart::compressed_uart.
+
+Usage: lzss_decode.py [input] [--window-bits <n>] [--length-bits <n>]
+
+Reads the compressed stream from a file, a serial device opened as a file or stdin, and writes
+the decoded bytes to stdout as soon as they are complete. The window and length widths must
+match the encoder template arguments, 8 and 4 by default.
+"""
+
+import argparse
+import sys
+
+MIN_MATCH = 2
+
+
+class Decoder:
+    def __init__(self, window_bits, length_bits):
+        self.window_bits = window_bits
+        self.length_bits = length_bits
+        self.window = bytearray(1 << window_bits)
+        self.mask = (1 << window_bits) - 1
+        self.pos = 0
+        self.bits = 0
+        self.bit_count = 0
+
+    def _peek(self, count):
+        return (self.bits >> (self.bit_count - count)) & ((1 << count) - 1)
+
+    def _take(self, count):
+        value = self._peek(count)
+        self.bit_count -= count
+        self.bits &= (1 << self.bit_count) - 1
+        return value
+
+    def _emit(self, out, byte):
+        self.window[self.pos & self.mask] = byte
+        self.pos += 1
+        out.append(byte)
+
+    def feed(self, data):
+        """Decode a chunk of the stream, return the complete decoded bytes"""
+        out = bytearray()
+        for byte in data:
+            self.bits = self.bits << 8 | byte
+            self.bit_count += 8
+            while self.bit_count >= 1 + self.window_bits:
+                if self._peek(1):
+                    if self.bit_count < 9:
+                        break
+                    self._emit(out, self._take(9) & 0xff)
+                    continue
+                distance = self._peek(1 + self.window_bits)
+                if distance == 0:
+                    # Flush, the rest of the byte is padding
+                    self._take(1 + self.window_bits)
+                    self._take(self.bit_count % 8)
+                    continue
+                if self.bit_count < 1 + self.window_bits + self.length_bits:
+                    break
+                length = self._take(1 + self.window_bits + self.length_bits)
+                length = (length & ((1 << self.length_bits) - 1)) + MIN_MATCH
+                for _ in range(length):
+                    self._emit(out, self.window[(self.pos - distance) & self.mask])
+        return bytes(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("input", nargs="?", help="compressed stream, stdin if omitted")
+    parser.add_argument("--window-bits", type=int, default=8)
+    parser.add_argument("--length-bits", type=int, default=4)
+    args = parser.parse_args()
+
+    decoder = Decoder(args.window_bits, args.length_bits)
+    source = open(args.input, "rb", buffering=0) if args.input else sys.stdin.buffer
+    with source:
+        while True:
+            chunk = source.read(256) if args.input else source.read1(256)
+            if not chunk:
+                break
+            sys.stdout.buffer.write(decoder.feed(chunk))
+            sys.stdout.buffer.flush()
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,165 @@
+#!/usr/bin/env python3
+"""Run the armpp probe firmware in QEMU and write an instruction and cycle count report.
+
+Usage: qemu_report.py --machine mps2-an385 --clock 25000000 [options] <firmware.elf>
+
+The firmware prints one line per probe (see qemu/probes.cpp):
+
+    probe <name> reps <count> ticks <systick cycles> cycles <dwt cycles>
+
+QEMU runs with `-icount shift=N`, every instruction advances the virtual clock by 2^N ns, so
+the SysTick cycles spent in a probe give the exact number of instructions executed. The
+`cycles` column is the number of core clock cycles the emulated SysTick counted, QEMU doesn't
+model the pipeline, the value is the instruction count scaled by the virtual clock rate. When
+the core implements the DWT cycle counter (real hardware running the same firmware) its value
+is reported instead.
+
+The cost of the measurement, the `empty` probe, is subtracted from the other probes. With
+--baseline the report is compared with a previous one and the script fails when a probe
+executes more instructions than the threshold allows.
+"""
+
+import argparse
+import json
+import subprocess
+import sys
+
+
+def run_qemu(args):
+    command = [
+        args.qemu,
+        "-M", args.machine,
+        "-cpu", args.cpu,
+        "-kernel", args.firmware,
+        "-display", "none",
+        "-monitor", "none",
+        "-serial", "stdio",
+        "-serial", "null",
+        "-semihosting-config", "enable=on,target=native",
+        "-icount", f"shift={args.icount_shift},align=off,sleep=off",
+    ]
+    result = subprocess.run(command, capture_output=True, text=True, timeout=args.timeout)
+    if result.returncode != 0:
+        sys.stderr.write(result.stdout)
+        sys.stderr.write(result.stderr)
+        raise SystemExit(f"QEMU exited with status {result.returncode}")
+    return result.stdout
+
+
+def parse(output):
+    probes = {}
+    done = False
+    for line in output.splitlines():
+        fields = line.split()
+        if fields[:1] == ["done"]:
+            done = True
+        if fields[:1] != ["probe"] or len(fields) != 8:
+            continue
+        values = dict(zip(fields[2::2], fields[3::2]))
+        probes[fields[1]] = {
+            "reps": int(values["reps"]),
+            "ticks": int(values["ticks"]),
+            "cycles": int(values["cycles"]),
+        }
+    if not done:
+        raise SystemExit("The firmware didn't finish, output:\n" + output)
+    return probes
+
+
+def analyze(probes, args):
+    # Virtual nanoseconds per SysTick cycle and per instruction
+    ns_per_tick = 1e9 / args.clock
+    ns_per_instruction = 2 ** args.icount_shift
+
+    def per_rep(probe, key):
+        return probe[key] / probe["reps"]
+
+    empty = probes.pop("empty")
+    report = {}
+    for name, probe in sorted(probes.items()):
+        ticks = per_rep(probe, "ticks") - per_rep(empty, "ticks")
+        instructions = ticks * ns_per_tick / ns_per_instruction
+        if probe["cycles"]:
+            cycles = per_rep(probe, "cycles") - per_rep(empty, "cycles")
+            source = "dwt"
+        else:
+            cycles = ticks
+            source = "systick"
+        report[name] = {
+            "instructions": round(instructions, 1),
+            "cycles": round(cycles, 1),
+            "cycle_source": source,
+        }
+    return report
+
+
+def compare(report, baseline, threshold):
+    regressions = []
+    for name, probe in report.items():
+        base = baseline.get(name)
+        probe["baseline_instructions"] = base["instructions"] if base else None
+        if not base or not base["instructions"]:
+            continue
+        change = (probe["instructions"] / base["instructions"] - 1) * 100
+        probe["change_percent"] = round(change, 1)
+        if change > threshold:
+            regressions.append(name)
+    return regressions
+
+
+def write_markdown(path, report, context):
+    with open(path, "w") as f:
+        f.write(f"# armpp QEMU probes, {context['machine']}, "
+                f"icount shift {context['icount_shift']}\n\n")
+        f.write("| probe | instructions | cycles | baseline | change |\n")
+        f.write("|---|---:|---:|---:|---:|\n")
+        for name, probe in report.items():
+            base = probe.get("baseline_instructions")
+            change = probe.get("change_percent")
+            f.write(f"| {name} | {probe['instructions']} | {probe['cycles']} "
+                    f"| {'' if base is None else base} "
+                    f"| {'' if change is None else f'{change:+.1f}%'} |\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("firmware")
+    parser.add_argument("--qemu", default="qemu-system-arm")
+    parser.add_argument("--machine", required=True)
+    parser.add_argument("--cpu", default="cortex-m3")
+    parser.add_argument("--clock", type=int, required=True, help="core clock in Hz")
+    parser.add_argument("--icount-shift", type=int, default=6)
+    parser.add_argument("--timeout", type=float, default=60)
+    parser.add_argument("--json", help="write the report as JSON")
+    parser.add_argument("--markdown", help="write the report as a markdown table")
+    parser.add_argument("--baseline", help="JSON report to compare with")
+    parser.add_argument("--threshold", type=float, default=0.0,
+                        help="instruction count increase in percent reported as a regression")
+    args = parser.parse_args()
+
+    probes = parse(run_qemu(args))
+    report = analyze(probes, args)
+
+    regressions = []
+    if args.baseline:
+        with open(args.baseline) as f:
+            regressions = compare(report, json.load(f)["probes"], args.threshold)
+
+    context = {"machine": args.machine, "clock": args.clock, "icount_shift": args.icount_shift}
+    print(f"{'probe':28} {'instructions':>14} {'cycles':>10}")
+    for name, probe in report.items():
+        mark = "  REGRESSION" if name in regressions else ""
+        print(f"{name:28} {probe['instructions']:14.1f} {probe['cycles']:10.1f}{mark}")
+
+    if args.json:
+        with open(args.json, "w") as f:
+            json.dump({"context": context, "probes": report}, f, indent=2)
+            f.write("\n")
+    if args.markdown:
+        write_markdown(args.markdown, report, context)
+
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
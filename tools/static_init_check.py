@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+"""Reject dynamic initialization of global state in the armpp libraries.
+
+Usage: static_init_check.py --nm <nm> <library or object>...
+
+The global state of the library is constant initialized and trivially destructible, so there is
+nothing to run before main and no guard check on the access to a function local static. The
+compiler emits a `_GLOBAL__sub_I_*` function for a translation unit with dynamic initializers or
+with destructors to register, and a `_ZGV*` guard variable for a function local static that is
+initialized on first use. Any of them in the inputs fails the check with the symbol and the object
+it is in.
+"""
+
+import argparse
+import re
+import subprocess
+import sys
+
+DYNAMIC_INIT_RE = re.compile(r"^(_GLOBAL__sub_I_|_GLOBAL__I_|_ZGV)")
+
+
+def scan(nm, path):
+    """Yield (object, symbol) for the dynamic initialization symbols defined in a file."""
+    output = subprocess.run([nm, "--defined-only", "-A", path], check=True, capture_output=True,
+                            text=True).stdout
+    for line in output.splitlines():
+        # <file>[:<member>]: <address> <type> <symbol>
+        location, _, rest = line.rpartition(": ")
+        if not location:
+            location, _, rest = line.rpartition(":")
+        fields = rest.split()
+        if not fields:
+            continue
+        symbol = fields[-1]
+        if DYNAMIC_INIT_RE.match(symbol):
+            yield location, symbol
+
+
+def demangle(symbols):
+    try:
+        output = subprocess.run(["c++filt"], input="\n".join(symbols), check=True,
+                                capture_output=True, text=True).stdout
+        return output.splitlines()
+    except (OSError, subprocess.CalledProcessError):
+        return symbols
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--nm", default="nm", help="nm of the toolchain")
+    parser.add_argument("inputs", nargs="+", help="libraries or object files")
+    args = parser.parse_args()
+
+    found = []
+    for path in args.inputs:
+        found.extend(scan(args.nm, path))
+    if not found:
+        return 0
+
+    names = demangle([symbol for _, symbol in found])
+    print("error: global state with dynamic initialization, make it constinit and trivially "
+          "destructible:", file=sys.stderr)
+    for (location, symbol), name in zip(found, names):
+        print(f"  {location}: {name if name != symbol else symbol}", file=sys.stderr)
+    return 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
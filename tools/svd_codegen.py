@@ -0,0 +1,487 @@
+#!/usr/bin/env python3
+"""Generate armpp register definitions from a CMSIS-SVD device description.
+
+Usage: svd_codegen.py <device.svd> -o <header.hpp> [--peripheral NAME]... [--namespace NS]
+                      [--byte-lanes NAME]... [--all-byte-lanes] [--no-bitband]
+
+For every selected peripheral the header gets:
+
+- an `enum class` for every field with enumerated values
+- a union of register fields for every register, with a `raw` member
+- a `<peripheral>_registers` struct laying out the registers at their offsets, with `offsetof`
+  static_asserts against the SVD address offsets, and a `<peripheral>_handle` static handle
+- a static handle alias for every peripheral derived from a generated one
+
+The access mode of a writable field is picked from the SVD access attributes, cheapest first:
+
+- `store_only` when writing zero to every other field of the register has no effect: the register
+  is write-only or all its writable fields are write-one-to-clear/set/toggle or write-only
+- `byte_lane` for byte and halfword fields aligned to their size, for peripherals on the private
+  peripheral bus (0xe0000000 and up) and the ones listed with --byte-lanes
+- `bitband` for one bit fields of peripherals in the Cortex-M3/M4 peripheral bit-band region,
+  when no field of the register has a write side effect the bus read-modify-write would trigger
+- the default access mode of the field type otherwise
+
+Overlapping fields of a register are an error, they are nearly always a copy-paste slip in the
+description. Registers sharing an address offset (`alternateRegister`) and clusters are not
+supported, they are skipped with a warning.
+"""
+
+import argparse
+import keyword
+import re
+import sys
+import textwrap
+import xml.etree.ElementTree as ElementTree
+
+LINE_WIDTH = 100
+
+PPB_BEGIN = 0xE0000000
+BITBAND_BEGIN = 0x40000000
+BITBAND_END = 0x40100000
+
+STORE_SAFE_WRITES = {"oneToClear", "oneToSet", "oneToToggle"}
+
+CXX_KEYWORDS = {
+    "alignas", "alignof", "and", "asm", "auto", "bool", "break", "case", "catch", "char",
+    "class", "const", "constexpr", "continue", "default", "delete", "do", "double", "else",
+    "enum", "explicit", "export", "extern", "false", "float", "for", "friend", "goto", "if",
+    "inline", "int", "long", "mutable", "namespace", "new", "noexcept", "not", "nullptr",
+    "operator", "or", "private", "protected", "public", "raw", "register", "return", "short",
+    "signed", "sizeof", "static", "struct", "switch", "template", "this", "throw", "true", "try",
+    "typedef", "typename", "union", "unsigned", "using", "virtual", "void", "volatile", "while",
+    "xor",
+}
+
+
+class SvdError(Exception):
+    pass
+
+
+def warn(message):
+    print(f"svd_codegen: warning: {message}", file=sys.stderr)
+
+
+def text(element, tag, default=None):
+    child = element.find(tag)
+    if child is None or child.text is None:
+        return default
+    return " ".join(child.text.split())
+
+
+def number(value):
+    value = value.strip().lower()
+    if value.startswith("#"):
+        return int(value[1:].replace("x", "0"), 2)
+    if value.startswith("0b"):
+        return int(value[2:], 2)
+    return int(value, 0)
+
+
+def identifier(name):
+    name = re.sub(r"%s|\[%s\]", "", name)
+    name = re.sub(r"[^0-9a-zA-Z_]", "_", name).lower().strip("_")
+    if not name or name[0].isdigit():
+        name = "_" + name
+    if name in CXX_KEYWORDS or keyword.iskeyword(name):
+        name += "_"
+    return name
+
+
+def comment(description, indent):
+    if not description:
+        return []
+    width = LINE_WIDTH - len(indent) - 3
+    lines = textwrap.wrap(description, width)
+    if len(lines) == 1 and len(lines[0]) <= width - 4:
+        return [f"{indent}/** {lines[0]} */"]
+    return [f"{indent}/**"] + [f"{indent} * {line}" for line in lines] + [f"{indent} */"]
+
+
+class Field:
+    def __init__(self, element, register):
+        self.name = identifier(text(element, "name"))
+        self.description = text(element, "description")
+        self.offset, self.width = self.bit_range(element)
+        self.access = text(element, "access", register.access)
+        self.modified_write = text(element, "modifiedWriteValues", register.modified_write)
+        self.read_action = text(element, "readAction", register.read_action)
+        self.enum_values = []
+        for values in element.findall("enumeratedValues"):
+            if values.get("derivedFrom"):
+                warn(f"{register.name}.{self.name}: derived enumerated values are not supported")
+                continue
+            usage = text(values, "usage", "read-write")
+            for value in values.findall("enumeratedValue"):
+                if text(value, "isDefault") == "true" or text(value, "value") is None:
+                    continue
+                self.enum_values.append((identifier(text(value, "name")),
+                                         number(text(value, "value")),
+                                         text(value, "description"), usage))
+            break
+        self.enum_name = None
+        self.mode = None
+
+    @staticmethod
+    def bit_range(element):
+        if element.find("bitOffset") is not None:
+            return number(text(element, "bitOffset")), number(text(element, "bitWidth", "1"))
+        if element.find("lsb") is not None:
+            lsb = number(text(element, "lsb"))
+            return lsb, number(text(element, "msb")) - lsb + 1
+        bit_range = text(element, "bitRange")
+        match = re.fullmatch(r"\[(\d+):(\d+)\]", bit_range or "")
+        if not match:
+            raise SvdError(f"field {text(element, 'name')} has no bit range")
+        msb, lsb = int(match.group(1)), int(match.group(2))
+        return lsb, msb - lsb + 1
+
+    @property
+    def readable(self):
+        return self.access != "write-only"
+
+    @property
+    def writable(self):
+        return self.access != "read-only"
+
+
+class Register:
+    def __init__(self, element, peripheral):
+        self.name = identifier(text(element, "name"))
+        self.description = text(element, "description")
+        self.offset = number(text(element, "addressOffset"))
+        self.size = number(text(element, "size", str(peripheral.size)))
+        self.access = text(element, "access", peripheral.access)
+        self.modified_write = text(element, "modifiedWriteValues")
+        self.read_action = text(element, "readAction")
+        self.alternate = text(element, "alternateRegister")
+        self.dim = number(text(element, "dim", "1"))
+        self.dim_increment = number(text(element, "dimIncrement", "0"))
+        self.type_name = self.name + "_register"
+        fields = element.find("fields")
+        self.fields = ([Field(field, self) for field in fields.findall("field")]
+                       if fields is not None else [])
+        self.fields.sort(key=lambda field: field.offset)
+        self.check_fields()
+
+    def check_fields(self):
+        used = 0
+        names = set()
+        for field in self.fields:
+            mask = ((1 << field.width) - 1) << field.offset
+            if field.offset + field.width > self.size:
+                raise SvdError(f"{self.name}.{field.name} is outside of the register")
+            if used & mask:
+                raise SvdError(f"{self.name}.{field.name} overlaps another field at bit "
+                               f"{field.offset}")
+            if field.name in names:
+                raise SvdError(f"{self.name}.{field.name} is defined twice")
+            used |= mask
+            names.add(field.name)
+
+    @property
+    def byte_size(self):
+        return self.size // 8
+
+    @property
+    def footprint(self):
+        if self.dim > 1:
+            return self.dim_increment * (self.dim - 1) + self.byte_size
+        return self.byte_size
+
+    def store_safe(self):
+        """Writing zeros to the fields not being written has no effect"""
+        if self.access == "write-only":
+            return True
+        writable = [field for field in self.fields if field.writable]
+        return bool(writable) and all(field.access == "write-only"
+                                      or field.modified_write in STORE_SAFE_WRITES
+                                      for field in writable)
+
+    def bus_rmw_safe(self):
+        """A read-modify-write of the register doesn't change the other fields"""
+        return all(field.modified_write in (None, "modify") and field.read_action is None
+                   for field in self.fields)
+
+
+class Peripheral:
+    def __init__(self, element, base=None):
+        self.name = identifier(text(element, "name"))
+        self.description = text(element, "description", base.description if base else None)
+        self.base_address = number(text(element, "baseAddress"))
+        self.derived_from = base
+        self.size = number(text(element, "size", "32"))
+        self.access = text(element, "access", "read-write")
+        self.type_name = self.name + "_registers"
+        if base is not None:
+            return
+        self.registers = []
+        block = element.find("registers")
+        if block is None:
+            return
+        if block.findall("cluster"):
+            warn(f"{self.name}: clusters are not supported, skipped")
+        for register in block.findall("register"):
+            self.registers.append(Register(register, self))
+        self.registers.sort(key=lambda register: register.offset)
+
+
+def parse_device(path):
+    root = ElementTree.parse(path).getroot()
+    defaults = {tag: text(root, tag) for tag in ("size", "access")}
+    peripherals = {}
+    for element in root.iter("peripheral"):
+        for tag, value in defaults.items():
+            if value is not None and element.find(tag) is None:
+                ElementTree.SubElement(element, tag).text = value
+        base_name = element.get("derivedFrom")
+        base = peripherals.get(identifier(base_name)) if base_name else None
+        if base_name and base is None:
+            raise SvdError(f"{text(element, 'name')} is derived from an unknown {base_name}")
+        peripheral = Peripheral(element, base)
+        peripherals[peripheral.name] = peripheral
+    return text(root, "name", "device"), peripherals
+
+
+def select_modes(peripheral, byte_lanes, bitband):
+    lanes = byte_lanes or peripheral.base_address >= PPB_BEGIN
+    in_bitband = bitband and BITBAND_BEGIN <= peripheral.base_address < BITBAND_END
+    for register in peripheral.registers:
+        store_safe = register.store_safe()
+        rmw_safe = register.bus_rmw_safe()
+        for field in register.fields:
+            if not field.writable:
+                field.mode = None
+            elif store_safe:
+                field.mode = "store_only"
+            elif field.modified_write in STORE_SAFE_WRITES:
+                warn(f"{peripheral.name}.{register.name}.{field.name}: writing the other fields "
+                     "writes back the ones read from this field")
+                field.mode = None
+            elif lanes and field.width in (8, 16) and field.offset % field.width == 0:
+                field.mode = "byte_lane"
+            elif in_bitband and field.width == 1 and rmw_safe:
+                field.mode = "bitband"
+            else:
+                field.mode = None
+
+
+def field_declaration(field):
+    if field.enum_name:
+        value_type = field.enum_name
+    elif field.width == 1 and field.modified_write == "oneToClear":
+        value_type = "raw_register"
+    elif field.width == 1 and field.modified_write == "oneToSet":
+        value_type = "set_t"
+    elif field.width == 1:
+        value_type = "bool"
+    else:
+        value_type = "raw_register"
+
+    if field.width == 1 and field.modified_write == "oneToClear" and field.readable:
+        if field.mode == "store_only":
+            return f"bit_read_clear_register_field<{field.offset}>"
+        access = f"access_mode::{field.mode}" if field.mode else "access_mode::bitwise_logic"
+        return f"bit_read_clear_register_field<{field.offset}, raw_register, {access}>"
+    if field.width == 1 and field.modified_write == "oneToClear":
+        value_type = "clear_t"
+
+    if not field.writable:
+        template = "read_only_register_field"
+    elif not field.readable:
+        template = "write_only_register_field"
+    else:
+        template = "read_write_register_field"
+    arguments = [value_type, str(field.offset), str(field.width)]
+    if field.mode:
+        arguments.append(f"access_mode::{field.mode}")
+    return f"{template}<{', '.join(arguments)}>"
+
+
+def assign_enum_names(peripheral, names):
+    for register in peripheral.registers:
+        for field in register.fields:
+            if not field.enum_values:
+                continue
+            name = field.name + "_t"
+            if name in names and names[name] != field.enum_values:
+                name = f"{register.name}_{field.name}_t"
+            names.setdefault(name, field.enum_values)
+            field.enum_name = name
+
+
+def emit_enums(peripheral, emitted, out):
+    for register in peripheral.registers:
+        for field in register.fields:
+            if not field.enum_name or field.enum_name in emitted:
+                continue
+            emitted.add(field.enum_name)
+            out += comment(f"{register.name.upper()}.{field.name.upper()} values", "")
+            out.append(f"enum class {field.enum_name} : raw_register {{")
+            width = max(len(name) for name, _, _, _ in field.enum_values)
+            for name, value, description, _ in field.enum_values:
+                line = f"    {name:<{width}} = {value:#x},"
+                if description and len(line) + len(description) + 8 <= LINE_WIDTH:
+                    line += f" /*!< {description} */"
+                out.append(line)
+            out.append("};")
+            out.append("")
+
+
+def emit_register(register, out):
+    if register.size != 32:
+        return
+    out += comment(register.description or register.name.upper(), "")
+    out.append(f"union {register.type_name} {{")
+    for field in register.fields:
+        out += comment(field.description, "    ")
+        declaration = field_declaration(field)
+        line = f"    {declaration} {field.name};"
+        if len(line) > LINE_WIDTH:
+            line = f"    {declaration}\n        {field.name};"
+        out.append(line)
+    if register.fields:
+        out.append("")
+    out.append("    raw_register volatile raw;")
+    out.append("};")
+    out.append(f"static_assert(sizeof({register.type_name}) == sizeof(raw_register));")
+    out.append("")
+
+
+def layout(peripheral):
+    """Members of the register struct in address order: (offset, type, name, count)"""
+    members = []
+    end = 0
+    reserved = 0
+    for register in peripheral.registers:
+        if register.alternate or register.offset < end:
+            warn(f"{peripheral.name}.{register.name} overlaps another register, skipped")
+            continue
+        if register.dim > 1 and register.dim_increment != register.byte_size:
+            warn(f"{peripheral.name}.{register.name}: sparse register arrays are not supported, "
+                 "skipped")
+            continue
+        if register.offset > end:
+            gap = register.offset - end
+            if gap % 4 == 0 and end % 4 == 0:
+                members.append((end, "raw_register", f"reserved{reserved}_", gap // 4))
+            else:
+                members.append((end, "std::uint8_t", f"reserved{reserved}_", gap))
+            reserved += 1
+        if register.size == 32:
+            type_name = register.type_name
+        else:
+            type_name = f"std::uint{register.size}_t volatile"
+            warn(f"{peripheral.name}.{register.name}: {register.size} bit register is accessed "
+                 "raw")
+        members.append((register.offset, type_name, register.name, register.dim))
+        end = register.offset + register.footprint
+    return members, end
+
+
+def emit_peripheral(peripheral, derived, out):
+    members, end = layout(peripheral)
+    out += comment(peripheral.description or peripheral.name.upper(), "")
+    out.append(f"struct {peripheral.type_name} {{")
+    out.append(f"    static constexpr address base_address = {peripheral.base_address:#010x};")
+    out.append("")
+    out.append(f"    {peripheral.type_name}() = delete;")
+    out.append("")
+    declarations = [(offset, type_name, f"{name}[{count}];" if count > 1 else f"{name};")
+                    for offset, type_name, name, count in members]
+    type_width = max((len(type_name) for _, type_name, _ in declarations), default=0)
+    name_width = max((len(member) for _, _, member in declarations), default=0)
+    for offset, type_name, member in declarations:
+        out.append(f"    {type_name:<{type_width}} {member:<{name_width}}    // {offset:#04x}")
+    out.append("};")
+    out.append("")
+    for offset, _, name, _ in members:
+        if not name.startswith("reserved"):
+            out.append(f"static_assert(offsetof({peripheral.type_name}, {name}) == {offset:#04x});")
+    out.append(f"static_assert(sizeof({peripheral.type_name}) == {end:#04x});")
+    out.append("")
+    out.append(f"using {peripheral.name}_handle = static_handle<{peripheral.type_name}>;")
+    for other in derived:
+        out.append(f"using {other.name}_handle = static_handle<{peripheral.type_name}, "
+                   f"{other.base_address:#010x}>;")
+    out.append("")
+
+
+def generate(svd, peripherals, namespace, byte_lanes, all_byte_lanes, bitband):
+    device, all_peripherals = parse_device(svd)
+    selected = []
+    for name in peripherals or all_peripherals:
+        peripheral = all_peripherals.get(identifier(name))
+        if peripheral is None:
+            raise SvdError(f"no peripheral {name} in {svd}")
+        selected.append(peripheral)
+
+    bases = []
+    derived = {}
+    for peripheral in selected:
+        base = peripheral.derived_from or peripheral
+        if base not in bases:
+            bases.append(base)
+        if peripheral.derived_from:
+            derived.setdefault(base.name, []).append(peripheral)
+
+    enum_names = {}
+    for peripheral in bases:
+        select_modes(peripheral, all_byte_lanes or peripheral.name in byte_lanes, bitband)
+        assign_enum_names(peripheral, enum_names)
+
+    out = [f"// Generated by tools/svd_codegen.py from the {device} SVD description, do not edit",
+           "#pragma once", "",
+           "#include <armpp/hal/handle_base.hpp>",
+           "#include <armpp/hal/registers.hpp>", "",
+           "#include <cstddef>",
+           "#include <cstdint>", "",
+           f"namespace {namespace} {{", ""]
+    emitted = set()
+    for peripheral in bases:
+        out.append("//" + "-" * 76)
+        out.append(f"// {peripheral.name.upper()}")
+        out.append("")
+        emit_enums(peripheral, emitted, out)
+        for register in peripheral.registers:
+            emit_register(register, out)
+        emit_peripheral(peripheral, derived.get(peripheral.name, []), out)
+    out.append(f"}}    // namespace {namespace}")
+    return "\n".join(out) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("svd")
+    parser.add_argument("-o", "--output", required=True, help="header to write")
+    parser.add_argument("--peripheral", action="append", default=[],
+                        help="peripheral to generate, all of them by default")
+    parser.add_argument("--namespace", help="namespace of the definitions, "
+                        "armpp::hal::<device> by default")
+    parser.add_argument("--byte-lanes", action="append", default=[],
+                        help="peripheral decoding byte and halfword accesses")
+    parser.add_argument("--all-byte-lanes", action="store_true",
+                        help="all peripherals decode byte and halfword accesses")
+    parser.add_argument("--no-bitband", action="store_true",
+                        help="the core has no bit-band regions (Cortex-M0/M0+/M7)")
+    args = parser.parse_args()
+
+    try:
+        namespace = args.namespace
+        if namespace is None:
+            device, _ = parse_device(args.svd)
+            namespace = f"armpp::hal::{identifier(device)}"
+        header = generate(args.svd, args.peripheral, namespace,
+                          {identifier(name) for name in args.byte_lanes}, args.all_byte_lanes,
+                          not args.no_bitband)
+    except (SvdError, ElementTree.ParseError, ValueError) as error:
+        print(f"svd_codegen: {args.svd}: {error}", file=sys.stderr)
+        return 1
+
+    with open(args.output, "w") as output:
+        output.write(header)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,153 @@
+#!/usr/bin/env python3
+"""Decode the binary telemetry stream written by armpp::telemetry::encoder.
+
+Usage: telemetry_decode.py [input] [--json]
+
+Reads the frames from a file, a serial device opened as a file or stdin. The schema frames the
+firmware sends describe the records, the decoder of a schema is built from its frame, so the
+host side follows the firmware without a separate description. Samples of a schema that was not
+announced yet are skipped, the delta samples are skipped until the next key sample.
+
+A line is printed per sample, `name field=value ...`, or a JSON object with --json.
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+KEY, DELTA, SCHEMA = 0, 1, 2
+FIXED, VARINT, DELTA_ENCODING = 0, 1, 2
+
+
+def read_varint(data, pos):
+    value = 0
+    shift = 0
+    while True:
+        byte = data[pos]
+        pos += 1
+        value |= (byte & 0x7f) << shift
+        if not byte & 0x80:
+            return value, pos
+        shift += 7
+
+
+def zigzag_decode(value):
+    return (value >> 1) ^ -(value & 1)
+
+
+class Field:
+    def __init__(self, name, type_code):
+        self.name = name
+        self.size = 1 << (type_code & 3)
+        self.signed = bool(type_code & 4)
+        self.floating = bool(type_code & 8)
+        self.encoding = (type_code >> 4) & 3
+        self.bits = self.size * 8
+
+    def wrap(self, value):
+        value &= (1 << self.bits) - 1
+        if self.signed and value >> (self.bits - 1):
+            value -= 1 << self.bits
+        return value
+
+    def decode(self, data, pos, previous):
+        if self.encoding == FIXED:
+            raw = data[pos:pos + self.size]
+            if self.floating:
+                value = struct.unpack("<f" if self.size == 4 else "<d", raw)[0]
+            else:
+                value = int.from_bytes(raw, "little", signed=self.signed)
+            return value, pos + self.size
+        value, pos = read_varint(data, pos)
+        if self.encoding == DELTA_ENCODING and previous is not None:
+            return self.wrap(previous + zigzag_decode(value)), pos
+        return (zigzag_decode(value) if self.signed else value), pos
+
+
+class Schema:
+    def __init__(self, payload):
+        size = payload[0]
+        self.name = payload[1:1 + size].decode()
+        pos = 1 + size
+        count = payload[pos]
+        pos += 1
+        self.fields = []
+        for _ in range(count):
+            size = payload[pos]
+            name = payload[pos + 1:pos + 1 + size].decode()
+            pos += 1 + size
+            self.fields.append(Field(name, payload[pos]))
+            pos += 1
+        self.previous = None
+
+    def decode(self, kind, payload):
+        if kind == DELTA and self.previous is None:
+            return None
+        values = []
+        pos = 0
+        for i, field in enumerate(self.fields):
+            previous = self.previous[i] if kind == DELTA else None
+            value, pos = field.decode(payload, pos, previous)
+            values.append(value)
+        self.previous = values
+        return values
+
+
+class Decoder:
+    def __init__(self):
+        self.schemas = {}
+        self.buffer = bytearray()
+
+    def feed(self, data):
+        """Decode a chunk of the stream, return the complete samples as (schema, values)"""
+        self.buffer += data
+        samples = []
+        while self.buffer and len(self.buffer) >= 1 + self.buffer[0]:
+            size = self.buffer[0]
+            frame = bytes(self.buffer[1:1 + size])
+            del self.buffer[:1 + size]
+            if not frame:
+                continue
+            schema_id, kind = frame[0] >> 2, frame[0] & 3
+            if kind == SCHEMA:
+                self.schemas[schema_id] = Schema(frame[1:])
+                continue
+            schema = self.schemas.get(schema_id)
+            if schema is None:
+                continue
+            try:
+                values = schema.decode(kind, frame[1:])
+            except (IndexError, struct.error):
+                schema.previous = None
+                continue
+            if values is not None:
+                samples.append((schema, values))
+        return samples
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("input", nargs="?", help="telemetry stream, stdin if omitted")
+    parser.add_argument("--json", action="store_true", help="one JSON object per sample")
+    args = parser.parse_args()
+
+    decoder = Decoder()
+    source = open(args.input, "rb", buffering=0) if args.input else sys.stdin.buffer
+    with source:
+        while True:
+            chunk = source.read(256) if args.input else source.read1(256)
+            if not chunk:
+                break
+            for schema, values in decoder.feed(chunk):
+                named = {f.name: v for f, v in zip(schema.fields, values)}
+                if args.json:
+                    print(json.dumps({"schema": schema.name, **named}), flush=True)
+                else:
+                    fields = " ".join(f"{k}={v}" for k, v in named.items())
+                    print(f"{schema.name} {fields}", flush=True)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())